@@ -0,0 +1,330 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include "../type_traits/type_traits.hpp"
+
+namespace myAlgorithm {
+
+// String and memory primitives. Each function is constexpr and runs a plain loop during
+// constant evaluation; at runtime, element types whose traits allow a bytewise view take
+// a vectorized (AVX2 or SSE2) path or the compiler's memchr/memcmp builtins instead.
+
+// Byte-scannable types: one byte wide and either integral or uniquely represented, so an
+// element equals a value exactly when their bytes are equal
+template <typename T>
+struct is_byte_scannable : myTypeTraits::bool_constant<
+    sizeof(T) == 1 &&
+    (myTypeTraits::is_integral_v<myTypeTraits::remove_cv_t<T>> ||
+     myTypeTraits::has_unique_object_representations_v<T>)>
+{};
+
+// Inline variable for easy access to is_byte_scannable value
+template <typename T>
+inline constexpr bool is_byte_scannable_v = is_byte_scannable<T>::value;
+
+// Bitwise-comparable types: equality of two ranges is equality of their bytes
+template <typename T>
+struct is_bitwise_comparable : myTypeTraits::bool_constant<
+    is_byte_scannable_v<T> || myTypeTraits::has_unique_object_representations_v<T>>
+{};
+
+// Inline variable for easy access to is_bitwise_comparable value
+template <typename T>
+inline constexpr bool is_bitwise_comparable_v = is_bitwise_comparable<T>::value;
+
+// Byte-orderable types: memcmp's unsigned byte order is the type's own order
+template <typename T>
+struct is_byte_orderable : myTypeTraits::bool_constant<
+    sizeof(T) == 1 && myTypeTraits::is_unsigned_v<myTypeTraits::remove_cv_t<T>> &&
+    !myTypeTraits::is_same_v<myTypeTraits::remove_cv_t<T>, bool>>
+{};
+
+// Inline variable for easy access to is_byte_orderable value
+template <typename T>
+inline constexpr bool is_byte_orderable_v = is_byte_orderable<T>::value;
+
+// Runtime-only byte scanning kernels (never called during constant evaluation)
+#if defined(__AVX2__) || defined(__SSE2__)
+
+#if defined(__AVX2__)
+inline constexpr size_t simd_width = 32;
+#else
+inline constexpr size_t simd_width = 16;
+#endif
+
+// Functions that deliberately read outside the caller's object are excluded from
+// AddressSanitizer instrumentation
+#if defined(__SANITIZE_ADDRESS__)
+#define MYALGORITHM_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define MYALGORITHM_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#endif
+#endif
+#if !defined(MYALGORITHM_NO_SANITIZE_ADDRESS)
+#define MYALGORITHM_NO_SANITIZE_ADDRESS
+#endif
+
+// Bit i of the result is set when block[i] == value; block needs no alignment
+inline unsigned simd_match_mask(const unsigned char* block, unsigned char value) noexcept
+{
+#if defined(__AVX2__)
+    __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    __m256i eq = _mm256_cmpeq_epi8(data, _mm256_set1_epi8(static_cast<char>(value)));
+    return static_cast<unsigned>(_mm256_movemask_epi8(eq));
+#else
+    __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+    __m128i eq = _mm_cmpeq_epi8(data, _mm_set1_epi8(static_cast<char>(value)));
+    return static_cast<unsigned>(_mm_movemask_epi8(eq));
+#endif
+}
+
+// Number of leading bytes of [p, p + n) to handle one at a time so that the vector
+// loop starts on a simd_width boundary
+inline size_t simd_head_length(const unsigned char* p, size_t n) noexcept
+{
+    size_t misalignment = reinterpret_cast<size_t>(p) % simd_width;
+    size_t head = misalignment == 0 ? 0 : simd_width - misalignment;
+    return head < n ? head : n;
+}
+
+// First occurrence of value in [p, p + n), or nullptr. Every load stays inside the range:
+// a scalar head up to the first aligned block, whole blocks, then a scalar tail.
+inline const unsigned char* memchr_runtime(const unsigned char* p, unsigned char value, size_t n) noexcept
+{
+    size_t i = 0;
+    for (size_t head = simd_head_length(p, n); i < head; ++i) {
+        if (p[i] == value) {
+            return p + i;
+        }
+    }
+    for (; i + simd_width <= n; i += simd_width) {
+        unsigned mask = simd_match_mask(p + i, value);
+        if (mask != 0) {
+            return p + i + __builtin_ctz(mask);
+        }
+    }
+    for (; i < n; ++i) {
+        if (p[i] == value) {
+            return p + i;
+        }
+    }
+    return nullptr;
+}
+
+// Number of bytes equal to value in [p, p + n), with the same head/blocks/tail split
+inline size_t count_runtime(const unsigned char* p, unsigned char value, size_t n) noexcept
+{
+    size_t result = 0;
+    size_t i = 0;
+    for (size_t head = simd_head_length(p, n); i < head; ++i) {
+        result += p[i] == value;
+    }
+    for (; i + simd_width <= n; i += simd_width) {
+        result += static_cast<size_t>(__builtin_popcount(simd_match_mask(p + i, value)));
+    }
+    for (; i < n; ++i) {
+        result += p[i] == value;
+    }
+    return result;
+}
+
+// Bit i of the result is set when block[i] == 0; block must be simd_width-aligned
+MYALGORITHM_NO_SANITIZE_ADDRESS
+inline unsigned simd_zero_mask_aligned(const unsigned char* block) noexcept
+{
+#if defined(__AVX2__)
+    __m256i data = _mm256_load_si256(reinterpret_cast<const __m256i*>(block));
+    return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(data, _mm256_setzero_si256())));
+#else
+    __m128i data = _mm_load_si128(reinterpret_cast<const __m128i*>(block));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(data, _mm_setzero_si128())));
+#endif
+}
+
+// Length of the zero-terminated byte string at p. The end is unknown, so the scan reads
+// whole aligned blocks: an aligned block never crosses a page boundary, so reading the
+// block that holds the terminator cannot fault, and bytes before p are masked off. Those
+// reads fall outside the string object, hence the sanitizer exclusion.
+MYALGORITHM_NO_SANITIZE_ADDRESS
+inline size_t strlen_runtime(const unsigned char* p) noexcept
+{
+    size_t offset = reinterpret_cast<size_t>(p) % simd_width;
+    const unsigned char* block = p - offset;
+    unsigned mask = simd_zero_mask_aligned(block) & ~((1u << offset) - 1u);
+    while (mask == 0) {
+        block += simd_width;
+        mask = simd_zero_mask_aligned(block);
+    }
+    return static_cast<size_t>(block + __builtin_ctz(mask) - p);
+}
+
+#else
+
+// No SIMD: the compiler builtins expand to the C library routines
+inline const unsigned char* memchr_runtime(const unsigned char* p, unsigned char value, size_t n) noexcept
+{
+    return static_cast<const unsigned char*>(__builtin_memchr(p, value, n));
+}
+
+inline size_t count_runtime(const unsigned char* p, unsigned char value, size_t n) noexcept
+{
+    size_t result = 0;
+    for (size_t i = 0; i < n; ++i) {
+        result += p[i] == value;
+    }
+    return result;
+}
+
+inline size_t strlen_runtime(const unsigned char* p) noexcept
+{
+    return __builtin_strlen(reinterpret_cast<const char*>(p));
+}
+
+#endif
+
+// Reinterpret a byte-scannable value as an unsigned char
+template <typename T>
+constexpr unsigned char as_byte(const T& value) noexcept
+{
+    return __builtin_bit_cast(unsigned char, value);
+}
+
+// Length of a zero-terminated string of integral characters
+template <typename CharT>
+    requires myTypeTraits::is_integral_v<CharT>
+constexpr size_t strlen(const CharT* s) noexcept
+{
+    if constexpr (is_byte_scannable_v<CharT>) {
+        if (!myTypeTraits::is_constant_evaluated()) {
+            return strlen_runtime(reinterpret_cast<const unsigned char*>(s));
+        }
+    }
+    size_t n = 0;
+    while (s[n] != CharT()) {
+        ++n;
+    }
+    return n;
+}
+
+// First occurrence of value among the n elements at p, or nullptr
+template <typename T>
+constexpr const T* memchr(const T* p, const myTypeTraits::remove_cv_t<T>& value, size_t n) noexcept
+{
+    if constexpr (is_byte_scannable_v<T>) {
+        if (!myTypeTraits::is_constant_evaluated()) {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(p);
+            const unsigned char* hit = memchr_runtime(bytes, as_byte(value), n);
+            return hit == nullptr ? nullptr : p + (hit - bytes);
+        }
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (p[i] == value) {
+            return p + i;
+        }
+    }
+    return nullptr;
+}
+
+// Element type of a contiguous iterator (pointers, std::string and std::vector iterators,
+// ...); the fast paths below view such ranges through std::to_address
+template <typename It>
+using contiguous_element_t = myTypeTraits::remove_reference_t<std::iter_reference_t<It>>;
+
+// First iterator in [first, last) equal to value, or last
+template <typename It, typename T>
+constexpr It find(It first, It last, const T& value)
+{
+    if constexpr (std::contiguous_iterator<It>) {
+        using E = contiguous_element_t<It>;
+        if constexpr (is_byte_scannable_v<E> &&
+                      myTypeTraits::is_same_v<myTypeTraits::remove_cv_t<E>, myTypeTraits::remove_cv_t<T>>) {
+            if (!myTypeTraits::is_constant_evaluated()) {
+                size_t n = static_cast<size_t>(last - first);
+                const unsigned char* bytes = reinterpret_cast<const unsigned char*>(std::to_address(first));
+                const unsigned char* hit = memchr_runtime(bytes, as_byte(value), n);
+                return hit == nullptr ? last : first + (hit - bytes);
+            }
+        }
+    }
+    for (; first != last; ++first) {
+        if (*first == value) {
+            return first;
+        }
+    }
+    return last;
+}
+
+// Number of elements in [first, last) equal to value
+template <typename It, typename T>
+constexpr ptrdiff_t count(It first, It last, const T& value)
+{
+    if constexpr (std::contiguous_iterator<It>) {
+        using E = contiguous_element_t<It>;
+        if constexpr (is_byte_scannable_v<E> &&
+                      myTypeTraits::is_same_v<myTypeTraits::remove_cv_t<E>, myTypeTraits::remove_cv_t<T>>) {
+            if (!myTypeTraits::is_constant_evaluated()) {
+                size_t n = static_cast<size_t>(last - first);
+                const unsigned char* bytes = reinterpret_cast<const unsigned char*>(std::to_address(first));
+                return static_cast<ptrdiff_t>(count_runtime(bytes, as_byte(value), n));
+            }
+        }
+    }
+    ptrdiff_t result = 0;
+    for (; first != last; ++first) {
+        if (*first == value) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+// True when [first1, last1) and the range starting at first2 hold equal elements
+template <typename It1, typename It2>
+constexpr bool equal(It1 first1, It1 last1, It2 first2)
+{
+    if constexpr (std::contiguous_iterator<It1> && std::contiguous_iterator<It2>) {
+        using E1 = myTypeTraits::remove_cv_t<contiguous_element_t<It1>>;
+        using E2 = myTypeTraits::remove_cv_t<contiguous_element_t<It2>>;
+        if constexpr (myTypeTraits::is_same_v<E1, E2> && is_bitwise_comparable_v<E1>) {
+            if (!myTypeTraits::is_constant_evaluated()) {
+                size_t bytes = static_cast<size_t>(last1 - first1) * sizeof(E1);
+                return __builtin_memcmp(std::to_address(first1), std::to_address(first2), bytes) == 0;
+            }
+        }
+    }
+    for (; first1 != last1; ++first1, ++first2) {
+        if (!(*first1 == *first2)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// memcmp-style lexicographical comparison of the n elements at a and b:
+// negative, zero or positive as a orders before, equal to or after b
+template <typename T>
+constexpr int compare(const T* a, const T* b, size_t n) noexcept
+{
+    if constexpr (is_byte_orderable_v<T>) {
+        if (!myTypeTraits::is_constant_evaluated()) {
+            return __builtin_memcmp(a, b, n);
+        }
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (a[i] < b[i]) {
+            return -1;
+        }
+        if (b[i] < a[i]) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+}
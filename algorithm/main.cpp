@@ -0,0 +1,47 @@
+//
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include "algorithm.hpp"
+
+enum class Level : uint8_t { Debug, Info, Warning, Error };
+
+// Evaluated at compile time through the constexpr loops
+constexpr size_t header_length = myAlgorithm::strlen("[INFO] ");
+constexpr const char* colon = myAlgorithm::memchr("key:value", ':', 9);
+
+int main() {
+    // Test trait gating
+    std::cout << "is_byte_scannable_v<char>: " << myAlgorithm::is_byte_scannable_v<char> << "\n"; // Expected: 1 (true)
+    std::cout << "is_byte_scannable_v<Level>: " << myAlgorithm::is_byte_scannable_v<Level> << "\n"; // Expected: 1 (true)
+    std::cout << "is_byte_scannable_v<int>: " << myAlgorithm::is_byte_scannable_v<int> << "\n"; // Expected: 0 (false)
+    std::cout << "is_bitwise_comparable_v<int>: " << myAlgorithm::is_bitwise_comparable_v<int> << "\n"; // Expected: 1 (true)
+    std::cout << "is_bitwise_comparable_v<float>: " << myAlgorithm::is_bitwise_comparable_v<float> << "\n"; // Expected: 0 (false)
+
+    // Test compile-time results
+    std::cout << "strlen(\"[INFO] \") at compile time: " << header_length << "\n"; // Expected: 7
+    std::cout << "memchr(\"key:value\", ':') at compile time: " << colon << "\n"; // Expected: :value
+
+    // Test runtime (vectorized) paths
+    std::string line = "2024-01-01 12:00:00 [ERROR] disk full; retrying in 5s; giving up after 3 attempts";
+    const char* begin = line.data();
+    const char* end = begin + line.size();
+    std::cout << "strlen(line): " << myAlgorithm::strlen(begin) << "\n"; // Expected: 81
+    std::cout << "find(line, '['): " << myAlgorithm::find(begin, end, '[') - begin << "\n"; // Expected: 20
+    std::cout << "find(line, '#') == end: " << (myAlgorithm::find(begin, end, '#') == end) << "\n"; // Expected: 1 (true)
+    std::cout << "count(line, ';'): " << myAlgorithm::count(begin, end, ';') << "\n"; // Expected: 2
+
+    Level levels[] = { Level::Info, Level::Error, Level::Debug, Level::Error };
+    std::cout << "count(levels, Error): " << myAlgorithm::count(levels, levels + 4, Level::Error) << "\n"; // Expected: 2
+
+    int lhs[] = { 1, 2, 3, 4 };
+    int rhs[] = { 1, 2, 3, 5 };
+    std::cout << "equal(lhs, rhs): " << myAlgorithm::equal(lhs, lhs + 4, rhs) << "\n"; // Expected: 0 (false)
+    std::cout << "equal(lhs, lhs): " << myAlgorithm::equal(lhs, lhs + 4, lhs) << "\n"; // Expected: 1 (true)
+
+    const unsigned char a[] = "abcd";
+    const unsigned char b[] = "abce";
+    std::cout << "compare(\"abcd\", \"abce\") < 0: " << (myAlgorithm::compare(a, b, 4) < 0) << "\n"; // Expected: 1 (true)
+
+    return 0;
+}
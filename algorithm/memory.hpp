@@ -0,0 +1,206 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include "../type_traits/type_traits.hpp"
+
+namespace myAlgorithm {
+
+// Trait-dispatched memory operations on contiguous ranges. Each operation checks the
+// element type's traits and, when they allow it, works on raw bytes (memmove, memset,
+// word-wise hashing) instead of element by element. The *_generic versions always take
+// the element-wise path; they are what the dispatched versions fall back to and let
+// benchmarks measure what each fast path saves.
+
+// True when assigning a T is the same as copying its bytes. Trivially copyable alone is
+// not enough: a type with a const or reference member is trivially copyable but cannot be
+// assigned at all, and must not be memmoved over by an assignment-based operation.
+template <typename T>
+inline constexpr bool is_bitwise_assignable_v =
+    myTypeTraits::is_trivially_copyable_v<T> && myTypeTraits::is_trivially_copy_assignable_v<T>;
+
+// Copy [first, last) to d_first by assignment, element by element
+template <typename T>
+T* copy_generic(const T* first, const T* last, T* d_first)
+{
+    for (; first != last; ++first, ++d_first) {
+        *d_first = *first;
+    }
+    return d_first;
+}
+
+// Copy [first, last) to d_first; bitwise assignable types are copied as bytes
+template <typename T>
+T* copy(const T* first, const T* last, T* d_first)
+{
+    if constexpr (is_bitwise_assignable_v<T>) {
+        const size_t n = static_cast<size_t>(last - first);
+        if (n != 0) {
+            __builtin_memmove(static_cast<void*>(d_first), static_cast<const void*>(first), n * sizeof(T));
+        }
+        return d_first + n;
+    } else {
+        return copy_generic(first, last, d_first);
+    }
+}
+
+// Assign value to every element of [first, last), element by element
+template <typename T>
+void fill_generic(T* first, T* last, const T& value)
+{
+    for (; first != last; ++first) {
+        *first = value;
+    }
+}
+
+// True when every byte of the object representation of value equals the first one
+template <typename T>
+bool has_repeated_byte(const T& value) noexcept
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+    for (size_t i = 1; i < sizeof(T); ++i) {
+        if (bytes[i] != bytes[0]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Assign value to every element of [first, last); bitwise assignable values made of a
+// single repeated byte (one-byte types, all-zero objects, ...) are stored with memset
+template <typename T>
+void fill(T* first, T* last, const T& value)
+{
+    if constexpr (is_bitwise_assignable_v<T>) {
+        if (has_repeated_byte(value)) {
+            const size_t n = static_cast<size_t>(last - first);
+            if (n != 0) {
+                __builtin_memset(static_cast<void*>(first), *reinterpret_cast<const unsigned char*>(&value), n * sizeof(T));
+            }
+            return;
+        }
+    }
+    fill_generic(first, last, value);
+}
+
+// Move-construct [first, last) into the uninitialized storage at d_first and destroy the
+// source elements, element by element
+template <typename T>
+T* relocate_generic(T* first, T* last, T* d_first)
+{
+    for (; first != last; ++first, ++d_first) {
+        ::new (static_cast<void*>(d_first)) T(std::move(*first));
+        first->~T();
+    }
+    return d_first;
+}
+
+// Relocate [first, last) into the uninitialized storage at d_first, leaving the source
+// storage uninitialized; trivially copyable types are relocated as bytes
+template <typename T>
+T* relocate(T* first, T* last, T* d_first)
+{
+    if constexpr (myTypeTraits::is_trivially_copyable_v<T>) {
+        const size_t n = static_cast<size_t>(last - first);
+        if (n != 0) {
+            __builtin_memmove(static_cast<void*>(d_first), static_cast<const void*>(first), n * sizeof(T));
+        }
+        return d_first + n;
+    } else {
+        return relocate_generic(first, last, d_first);
+    }
+}
+
+// Mixes value into seed (multiply-xorshift, 64-bit)
+constexpr uint64_t hash_combine(uint64_t seed, uint64_t value) noexcept
+{
+    value *= 0x9E3779B97F4A7C15ull;
+    value ^= value >> 32;
+    return (seed ^ value) * 0xFF51AFD7ED558CCDull;
+}
+
+// Hash of n bytes, consumed eight at a time
+inline uint64_t hash_bytes(const void* data, size_t n, uint64_t seed = 0) noexcept
+{
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    uint64_t h = hash_combine(seed, n);
+    for (; n >= 8; n -= 8, p += 8) {
+        uint64_t word;
+        __builtin_memcpy(&word, p, 8);
+        h = hash_combine(h, word);
+    }
+    if (n != 0) {
+        uint64_t word = 0;
+        __builtin_memcpy(&word, p, n);
+        h = hash_combine(h, word);
+    }
+    return h;
+}
+
+// Number of leading bytes of a floating point object that hold its value. x87 extended
+// precision (64-bit mantissa) stores 10 value bytes padded to 12 or 16; the padding is
+// unspecified and must not reach a hash.
+template <typename T>
+constexpr size_t floating_value_bytes() noexcept
+{
+    if constexpr (myTypeTraits::is_same_v<T, long double> && __LDBL_MANT_DIG__ == 64) {
+        return 10;
+    } else {
+        return sizeof(T);
+    }
+}
+
+// Hash of an arithmetic value; class types provide hash_value found by argument-dependent lookup
+template <typename T>
+    requires myTypeTraits::is_arithmetic_v<T>
+constexpr uint64_t hash_value(T value) noexcept
+{
+    if constexpr (myTypeTraits::is_floating_point_v<T>) {
+        // +0.0 and -0.0 compare equal, so they must hash equal
+        if (value == T(0)) {
+            return 0;
+        }
+        if constexpr (sizeof(T) == sizeof(uint64_t)) {
+            return __builtin_bit_cast(uint64_t, value);
+        } else if constexpr (sizeof(T) == sizeof(uint32_t)) {
+            return __builtin_bit_cast(uint32_t, value);
+        } else {
+            // Wider formats: hash the bytes that hold the value, never a numeric conversion
+            struct representation
+            {
+                unsigned char bytes[sizeof(T)];
+            };
+            representation r = __builtin_bit_cast(representation, value);
+            return hash_bytes(r.bytes, floating_value_bytes<T>());
+        }
+    } else {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+// Hash of [first, last) combining hash_value of every element
+template <typename T>
+uint64_t hash_range_generic(const T* first, const T* last)
+{
+    uint64_t h = hash_combine(0, static_cast<uint64_t>(last - first));
+    for (; first != last; ++first) {
+        h = hash_combine(h, hash_value(*first));
+    }
+    return h;
+}
+
+// Hash of [first, last); types with unique object representations are hashed as one
+// block of bytes, since equal values are then guaranteed to have equal bytes
+template <typename T>
+uint64_t hash_range(const T* first, const T* last)
+{
+    if constexpr (myTypeTraits::has_unique_object_representations_v<T>) {
+        return hash_bytes(first, static_cast<size_t>(last - first) * sizeof(T));
+    } else {
+        return hash_range_generic(first, last);
+    }
+}
+
+}
@@ -0,0 +1,343 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <vector>
+#include "../execution/execution.hpp"
+#include "../execution/thread_pool.hpp"
+
+// Loop annotation for par_unseq chunks: iterations carry no dependences
+#if defined(__clang__)
+#define MYALGORITHM_UNSEQ_LOOP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define MYALGORITHM_UNSEQ_LOOP _Pragma("GCC ivdep")
+#else
+#define MYALGORITHM_UNSEQ_LOOP
+#endif
+
+namespace myAlgorithm {
+
+// Parallel algorithms. Each takes an execution policy first and random-access iterators.
+// seq runs the plain loop on the calling thread; par and par_unseq split the range into
+// chunks sized by myExecution::chunk_size for the element type and run them on the
+// policy's pool, with the calling thread taking part.
+
+// Element type an iterator refers to, used to pick the chunk size
+template <typename It>
+using iter_value_t = myTypeTraits::remove_cv_t<myTypeTraits::remove_reference_t<decltype(*myTypeTraits::declval<It&>())>>;
+
+// True for policies that run on a thread pool
+template <typename Policy>
+inline constexpr bool is_parallel_policy_v =
+    myExecution::is_execution_policy_v<Policy> &&
+    !myTypeTraits::is_same_v<myTypeTraits::remove_cv_t<myTypeTraits::remove_reference_t<Policy>>,
+                             myExecution::sequenced_policy>;
+
+// True for policies that also allow vectorizing the loop inside a chunk
+template <typename Policy>
+inline constexpr bool is_unsequenced_policy_v =
+    myTypeTraits::is_same_v<myTypeTraits::remove_cv_t<myTypeTraits::remove_reference_t<Policy>>,
+                            myExecution::parallel_unsequenced_policy>;
+
+// Pool a parallel policy runs on
+template <typename Policy>
+myExecution::thread_pool& policy_pool(const Policy& policy) noexcept
+{
+    return policy.pool != nullptr ? *policy.pool : myExecution::thread_pool::default_pool();
+}
+
+// How a range of n elements is split: `count` chunks of `size` elements (the last may be shorter)
+struct chunk_plan
+{
+    size_t size;
+    size_t count;
+};
+
+template <typename T>
+chunk_plan plan_chunks(const myExecution::thread_pool& pool, size_t n) noexcept
+{
+    size_t size = myExecution::chunk_size<T>(n, pool.size() + 1);
+    return chunk_plan{ size, n == 0 ? 0 : (n + size - 1) / size };
+}
+
+// Call body(index, begin, end) for every chunk of [0, n); the caller runs chunk 0 itself
+template <typename Body>
+void run_chunks(myExecution::thread_pool& pool, size_t n, chunk_plan plan, Body& body)
+{
+    if (plan.count <= 1) {
+        if (n != 0) {
+            body(size_t(0), size_t(0), n);
+        }
+        return;
+    }
+    myExecution::task_group group(pool);
+    for (size_t index = 1; index < plan.count; ++index) {
+        size_t begin = index * plan.size;
+        size_t end = begin + plan.size < n ? begin + plan.size : n;
+        group.run([&body, index, begin, end] { body(index, begin, end); });
+    }
+    body(size_t(0), size_t(0), plan.size);
+    group.wait();
+}
+
+// Apply f to every element of [first, last)
+template <typename Policy, typename It, typename F>
+    requires myExecution::is_execution_policy_v<Policy>
+void for_each(Policy&& policy, It first, It last, F f)
+{
+    const size_t n = static_cast<size_t>(last - first);
+    if constexpr (!is_parallel_policy_v<Policy>) {
+        for (size_t i = 0; i < n; ++i) {
+            f(first[i]);
+        }
+    } else {
+        myExecution::thread_pool& pool = policy_pool(policy);
+        auto body = [first, &f](size_t, size_t begin, size_t end) {
+            if constexpr (is_unsequenced_policy_v<Policy>) {
+                MYALGORITHM_UNSEQ_LOOP
+                for (size_t i = begin; i < end; ++i) {
+                    f(first[i]);
+                }
+            } else {
+                for (size_t i = begin; i < end; ++i) {
+                    f(first[i]);
+                }
+            }
+        };
+        run_chunks(pool, n, plan_chunks<iter_value_t<It>>(pool, n), body);
+    }
+}
+
+// Write op(x) for every x in [first, last) to the range starting at d_first
+template <typename Policy, typename It, typename OutIt, typename UnaryOp>
+    requires myExecution::is_execution_policy_v<Policy>
+OutIt transform(Policy&& policy, It first, It last, OutIt d_first, UnaryOp op)
+{
+    const size_t n = static_cast<size_t>(last - first);
+    if constexpr (!is_parallel_policy_v<Policy>) {
+        for (size_t i = 0; i < n; ++i) {
+            d_first[i] = op(first[i]);
+        }
+    } else {
+        myExecution::thread_pool& pool = policy_pool(policy);
+        auto body = [first, d_first, &op](size_t, size_t begin, size_t end) {
+            if constexpr (is_unsequenced_policy_v<Policy>) {
+                MYALGORITHM_UNSEQ_LOOP
+                for (size_t i = begin; i < end; ++i) {
+                    d_first[i] = op(first[i]);
+                }
+            } else {
+                for (size_t i = begin; i < end; ++i) {
+                    d_first[i] = op(first[i]);
+                }
+            }
+        };
+        run_chunks(pool, n, plan_chunks<iter_value_t<It>>(pool, n), body);
+    }
+    return d_first + n;
+}
+
+// Cache line size assumed when padding per-thread data against false sharing
+inline constexpr size_t cache_line_size = 64;
+
+// One chunk's partial result in reduce. Each gets its own cache line so neighbouring
+// chunks never write the same line (or, as std::vector<bool> would, the same word).
+template <typename T>
+struct alignas(cache_line_size) alignas(T) reduce_slot
+{
+    T value;
+};
+
+// Combine init and every element of [first, last) with op. op must be associative and
+// commutative: each chunk is folded separately and the partial results are combined in order.
+template <typename Policy, typename It, typename T, typename BinaryOp>
+    requires myExecution::is_execution_policy_v<Policy>
+T reduce(Policy&& policy, It first, It last, T init, BinaryOp op)
+{
+    const size_t n = static_cast<size_t>(last - first);
+    if constexpr (!is_parallel_policy_v<Policy>) {
+        for (size_t i = 0; i < n; ++i) {
+            init = op(init, first[i]);
+        }
+        return init;
+    } else {
+        myExecution::thread_pool& pool = policy_pool(policy);
+        chunk_plan plan = plan_chunks<iter_value_t<It>>(pool, n);
+        std::vector<reduce_slot<T>> partials(plan.count, reduce_slot<T>{ init });
+        auto body = [first, &op, &partials](size_t index, size_t begin, size_t end) {
+            T acc = first[begin];
+            for (size_t i = begin + 1; i < end; ++i) {
+                acc = op(acc, first[i]);
+            }
+            partials[index].value = acc;
+        };
+        run_chunks(pool, n, plan, body);
+        for (const reduce_slot<T>& partial : partials) {
+            init = op(init, partial.value);
+        }
+        return init;
+    }
+}
+
+// Sum of init and every element of [first, last)
+template <typename Policy, typename It, typename T>
+    requires myExecution::is_execution_policy_v<Policy>
+T reduce(Policy&& policy, It first, It last, T init)
+{
+    return myAlgorithm::reduce(policy, first, last, init, std::plus<>());
+}
+
+// Number of elements of the sorted run a that come first in the merge of a and b
+// (a's elements first among equal ones) when that merge is cut after k elements
+template <typename It, typename Compare>
+size_t merge_co_rank(It a, size_t a_size, It b, size_t b_size, size_t k, Compare& comp)
+{
+    size_t lo = k > b_size ? k - b_size : 0;
+    size_t hi = k < a_size ? k : a_size;
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        // a[i] belongs before the cut unless it is greater than b[k - i - 1]
+        if (!comp(b[k - i - 1], a[i])) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+// One round of sort's merge phase: move-merge neighbouring runs of src (run i covers
+// [bounds[i], bounds[i + 1])) pairwise into dst. Every merge is cut at co-ranked points
+// into pieces of about piece_size output elements, so a round has as many tasks as the
+// chunk sort had, however few merges are left.
+template <typename Src, typename Dst, typename Compare>
+void merge_round(myExecution::thread_pool& pool, Src src, Dst dst, const std::vector<size_t>& bounds,
+                 size_t piece_size, Compare& comp)
+{
+    // Piece output [out_begin, out_end) (offsets into the merge starting at src + begin)
+    // takes a[a_begin, a_end) and b[out_begin - a_begin, out_end - a_end)
+    struct piece
+    {
+        size_t begin;  // first element of the left run a
+        size_t middle; // first element of the right run b
+        size_t out_begin;
+        size_t out_end;
+        size_t a_begin;
+        size_t a_end;
+    };
+    // Cut points are found before any piece runs: pieces move elements out of src, and a
+    // binary search running next to them would compare moved-from values
+    std::vector<piece> pieces;
+    for (size_t i = 0; i + 1 < bounds.size(); i += 2) {
+        // A trailing run without a partner is "merged" with an empty one, i.e. moved
+        const size_t end = i + 2 < bounds.size() ? bounds[i + 2] : bounds[i + 1];
+        const size_t a_size = bounds[i + 1] - bounds[i];
+        const size_t b_size = end - bounds[i + 1];
+        size_t a_begin = 0;
+        for (size_t out = 0; out < a_size + b_size; out += piece_size) {
+            const size_t out_end = a_size + b_size - out < piece_size ? a_size + b_size : out + piece_size;
+            const size_t a_end = merge_co_rank(src + bounds[i], a_size, src + bounds[i + 1], b_size, out_end, comp);
+            pieces.push_back(piece{ bounds[i], bounds[i + 1], out, out_end, a_begin, a_end });
+            a_begin = a_end;
+        }
+    }
+    auto body = [src, dst, &pieces, &comp](size_t index, size_t, size_t) {
+        const piece& p = pieces[index];
+        // Compare lvalues and move the winner (std::merge over move iterators would hand
+        // comp rvalues)
+        Src a = src + (p.begin + p.a_begin);
+        Src a_end = src + (p.begin + p.a_end);
+        Src b = src + (p.middle + (p.out_begin - p.a_begin));
+        Src b_end = src + (p.middle + (p.out_end - p.a_end));
+        Dst out = dst + (p.begin + p.out_begin);
+        for (; a != a_end && b != b_end; ++out) {
+            if (comp(*b, *a)) {
+                *out = std::move(*b);
+                ++b;
+            } else {
+                *out = std::move(*a);
+                ++a;
+            }
+        }
+        out = std::move(a, a_end, out);
+        std::move(b, b_end, out);
+    };
+    run_chunks(pool, pieces.size(), chunk_plan{ 1, pieces.size() }, body);
+}
+
+// Sort [first, last) by comp. Parallel policies sort every chunk independently and then
+// merge neighbouring runs pairwise, ping-ponging between the range and a scratch buffer
+// of n elements. Each merge is split at co-ranked points (see merge_round), so every
+// round, the final one over all n elements included, runs on all threads.
+template <typename Policy, typename It, typename Compare = std::less<>>
+    requires myExecution::is_execution_policy_v<Policy>
+void sort(Policy&& policy, It first, It last, Compare comp = Compare())
+{
+    const size_t n = static_cast<size_t>(last - first);
+    if constexpr (!is_parallel_policy_v<Policy>) {
+        std::sort(first, last, comp);
+    } else {
+        using T = iter_value_t<It>;
+        myExecution::thread_pool& pool = policy_pool(policy);
+        chunk_plan plan = plan_chunks<T>(pool, n);
+        if (plan.count <= 1) {
+            std::sort(first, last, comp);
+            return;
+        }
+
+        // Each chunk task sorts its run and moves it into the scratch buffer, so the
+        // merge rounds only ever assign to constructed elements
+        std::allocator<T> allocator;
+        T* scratch = allocator.allocate(n);
+        auto sort_body = [first, scratch, &comp](size_t, size_t begin, size_t end) {
+            std::sort(first + begin, first + end, comp);
+            for (size_t i = begin; i < end; ++i) {
+                ::new (static_cast<void*>(scratch + i)) T(std::move(first[i]));
+            }
+        };
+        run_chunks(pool, n, plan, sort_body);
+
+        // Run i covers [bounds[i], bounds[i + 1])
+        std::vector<size_t> bounds;
+        for (size_t index = 0; index < plan.count; ++index) {
+            bounds.push_back(index * plan.size);
+        }
+        bounds.push_back(n);
+
+        bool in_scratch = true;
+        while (bounds.size() > 2) {
+            if (in_scratch) {
+                merge_round(pool, scratch, first, bounds, plan.size, comp);
+            } else {
+                merge_round(pool, first, scratch, bounds, plan.size, comp);
+            }
+            in_scratch = !in_scratch;
+
+            std::vector<size_t> merged;
+            for (size_t i = 0; i + 1 < bounds.size(); i += 2) {
+                merged.push_back(bounds[i]);
+            }
+            merged.push_back(n);
+            bounds.swap(merged);
+        }
+
+        // Move the result back if it ended up in scratch, and destroy the scratch elements
+        // (a no-op for trivially copyable types, whose destructors are trivial)
+        auto finish_body = [first, scratch, in_scratch](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (in_scratch) {
+                    first[i] = std::move(scratch[i]);
+                }
+                scratch[i].~T();
+            }
+        };
+        if (in_scratch || !myTypeTraits::is_trivially_copyable_v<T>) {
+            run_chunks(pool, n, plan, finish_body);
+        }
+        allocator.deallocate(scratch, n);
+    }
+}
+}
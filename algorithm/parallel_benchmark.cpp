@@ -0,0 +1,138 @@
+//
+// Scaling benchmark for the parallel algorithms: every operation runs with seq and then
+// with par/par_unseq on 1, 2, 4, ... hardware threads (the pool's workers plus the caller).
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "parallel.hpp"
+
+// Median wall time in milliseconds of `repetitions` runs of op (setup is not timed)
+template <typename Setup, typename Op>
+double time_ms(int repetitions, Setup setup, Op op)
+{
+    std::vector<double> samples;
+    for (int r = 0; r < repetitions; ++r) {
+        setup();
+        auto start = std::chrono::steady_clock::now();
+        op();
+        auto stop = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+void report(const char* name, size_t threads, double ms, double baseline_ms)
+{
+    std::cout << std::left << std::setw(28) << name << std::right
+              << std::setw(8) << threads
+              << std::setw(12) << std::fixed << std::setprecision(2) << ms
+              << std::setw(10) << std::setprecision(2) << baseline_ms / ms << "x\n";
+}
+
+int main(int argc, char** argv) {
+    const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : (size_t(1) << 24);
+    const int repetitions = 5;
+    const size_t max_threads = std::thread::hardware_concurrency() == 0 ? 1 : std::thread::hardware_concurrency();
+
+    std::vector<size_t> thread_counts;
+    for (size_t t = 1; t < max_threads; t *= 2) {
+        thread_counts.push_back(t);
+    }
+    thread_counts.push_back(max_threads);
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(0.0, 1000.0);
+    std::vector<double> source(n);
+    for (double& x : source) {
+        x = dist(rng);
+    }
+    // Already sorted input makes the chunk sorts cheap, so sort's merge rounds dominate
+    std::vector<double> sorted_source = source;
+    std::sort(sorted_source.begin(), sorted_source.end());
+    std::vector<double> data(n);
+    std::vector<double> out(n);
+    std::vector<std::string> words(n / 16);
+    for (size_t i = 0; i < words.size(); ++i) {
+        words[i] = "record-" + std::to_string(rng());
+    }
+    std::vector<size_t> lengths(words.size());
+
+    auto reset = [&] { data = source; };
+    auto reset_sorted = [&] { data = sorted_source; };
+    auto nothing = [] {};
+    auto work = [](double& x) { x = std::sqrt(x) * 1.0001 + 0.5; };
+    auto square = [](double x) { return x * x; };
+    auto length = [](const std::string& s) { return s.size(); };
+
+    std::cout << "n = " << n << " doubles, " << words.size() << " strings, median of "
+              << repetitions << " runs\n";
+    std::cout << std::left << std::setw(28) << "operation" << std::right << std::setw(8) << "threads"
+              << std::setw(12) << "ms" << std::setw(11) << "speedup\n";
+
+    const double seq_for_each = time_ms(repetitions, reset, [&] {
+        myAlgorithm::for_each(myExecution::seq, data.begin(), data.end(), work);
+    });
+    const double seq_transform = time_ms(repetitions, nothing, [&] {
+        myAlgorithm::transform(myExecution::seq, source.begin(), source.end(), out.begin(), square);
+    });
+    double seq_sum = 0;
+    const double seq_reduce = time_ms(repetitions, nothing, [&] {
+        seq_sum = myAlgorithm::reduce(myExecution::seq, source.begin(), source.end(), 0.0);
+    });
+    const double seq_sort = time_ms(repetitions, reset, [&] {
+        myAlgorithm::sort(myExecution::seq, data.begin(), data.end());
+    });
+    const double seq_sort_sorted = time_ms(repetitions, reset_sorted, [&] {
+        myAlgorithm::sort(myExecution::seq, data.begin(), data.end());
+    });
+    const double seq_strings = time_ms(repetitions, nothing, [&] {
+        myAlgorithm::transform(myExecution::seq, words.begin(), words.end(), lengths.begin(), length);
+    });
+    report("for_each seq", 1, seq_for_each, seq_for_each);
+    report("transform seq", 1, seq_transform, seq_transform);
+    report("reduce seq", 1, seq_reduce, seq_reduce);
+    report("sort seq", 1, seq_sort, seq_sort);
+    report("sort<sorted> seq", 1, seq_sort_sorted, seq_sort_sorted);
+    report("transform<string> seq", 1, seq_strings, seq_strings);
+
+    bool ok = true;
+    for (size_t threads : thread_counts) {
+        myExecution::thread_pool pool(threads - 1);
+        const auto par = myExecution::par.on(pool);
+        const auto par_unseq = myExecution::par_unseq.on(pool);
+
+        report("for_each par_unseq", threads, time_ms(repetitions, reset, [&] {
+            myAlgorithm::for_each(par_unseq, data.begin(), data.end(), work);
+        }), seq_for_each);
+        report("transform par_unseq", threads, time_ms(repetitions, nothing, [&] {
+            myAlgorithm::transform(par_unseq, source.begin(), source.end(), out.begin(), square);
+        }), seq_transform);
+        double sum = 0;
+        report("reduce par", threads, time_ms(repetitions, nothing, [&] {
+            sum = myAlgorithm::reduce(par, source.begin(), source.end(), 0.0);
+        }), seq_reduce);
+        ok = ok && std::fabs(sum - seq_sum) <= 1e-9 * seq_sum;
+        report("sort par", threads, time_ms(repetitions, reset, [&] {
+            myAlgorithm::sort(par, data.begin(), data.end());
+        }), seq_sort);
+        ok = ok && std::is_sorted(data.begin(), data.end());
+        report("sort<sorted> par", threads, time_ms(repetitions, reset_sorted, [&] {
+            myAlgorithm::sort(par, data.begin(), data.end());
+        }), seq_sort_sorted);
+        ok = ok && data == sorted_source;
+        report("transform<string> par", threads, time_ms(repetitions, nothing, [&] {
+            myAlgorithm::transform(par, words.begin(), words.end(), lengths.begin(), length);
+        }), seq_strings);
+    }
+
+    std::cout << "results match seq: " << ok << "\n"; // Expected: 1 (true)
+    return ok ? 0 : 1;
+}
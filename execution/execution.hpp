@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include "../type_traits/type_traits.hpp"
+
+namespace myExecution {
+
+class thread_pool;
+
+// Sequenced execution: the algorithm runs on the calling thread
+struct sequenced_policy
+{};
+
+// Parallel execution: chunks of the range run on a thread pool
+// (the default pool unless the policy is bound to one with on())
+struct parallel_policy
+{
+    thread_pool* pool = nullptr;
+
+    constexpr parallel_policy on(thread_pool& p) const noexcept
+    {
+        return parallel_policy{ &p };
+    }
+};
+
+// Parallel and unsequenced execution: as parallel_policy, and the loop inside each
+// chunk may additionally be vectorized
+struct parallel_unsequenced_policy
+{
+    thread_pool* pool = nullptr;
+
+    constexpr parallel_unsequenced_policy on(thread_pool& p) const noexcept
+    {
+        return parallel_unsequenced_policy{ &p };
+    }
+};
+
+// Policy objects
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+
+// Is Execution Policy Type Trait
+template <typename T>
+struct is_execution_policy : myTypeTraits::false_type
+{};
+
+// Specializations for the standard policies
+template <>
+struct is_execution_policy<sequenced_policy> : myTypeTraits::true_type
+{};
+
+template <>
+struct is_execution_policy<parallel_policy> : myTypeTraits::true_type
+{};
+
+template <>
+struct is_execution_policy<parallel_unsequenced_policy> : myTypeTraits::true_type
+{};
+
+// Inline variable for easy access to is_execution_policy value
+// (cv-qualifiers and references are ignored so policies can be passed by reference)
+template <typename T>
+inline constexpr bool is_execution_policy_v =
+    is_execution_policy<myTypeTraits::remove_cv_t<myTypeTraits::remove_reference_t<T>>>::value;
+
+// Minimum number of elements of type T handed to one task. Trivially copyable arithmetic
+// types get large chunks (256 KiB) so that each task runs long vectorized loops; other
+// trivially copyable types get 32 KiB; types with non-trivial copies or destructors get
+// small chunks because each element is expensive and uneven work needs stealing.
+template <typename T>
+constexpr size_t grain_size() noexcept
+{
+    using U = myTypeTraits::remove_cv_t<T>;
+    if constexpr (myTypeTraits::is_arithmetic_v<U> && myTypeTraits::is_trivially_copyable_v<U>) {
+        return (size_t(256) << 10) / sizeof(U);
+    } else if constexpr (myTypeTraits::is_trivially_copyable_v<U>) {
+        size_t n = (size_t(32) << 10) / sizeof(U);
+        return n == 0 ? 1 : n;
+    } else {
+        return 64;
+    }
+}
+
+// Chunk size for n elements on `workers` threads: at least grain_size<T>(), and small
+// enough to give every thread several chunks so idle threads have work to steal
+template <typename T>
+constexpr size_t chunk_size(size_t n, size_t workers) noexcept
+{
+    constexpr size_t chunks_per_worker = 4;
+    size_t balanced = (n + workers * chunks_per_worker - 1) / (workers * chunks_per_worker);
+    size_t grain = grain_size<T>();
+    return balanced > grain ? balanced : grain;
+}
+
+}
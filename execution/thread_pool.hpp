@@ -0,0 +1,227 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace myExecution {
+
+// Work-stealing thread pool. Every worker owns a deque: it pushes and pops its own tasks
+// at the back (most recently spawned, still hot in cache) and, when empty, steals from
+// the front of the other workers' deques (oldest, usually largest, tasks).
+// Threads that wait for tasks (see task_group::wait) run queued tasks themselves, so a
+// pool with zero workers is valid and runs everything on the waiting thread.
+class thread_pool
+{
+public:
+    explicit thread_pool(size_t workers = default_worker_count())
+        : queues_(workers == 0 ? 1 : workers)
+    {
+        for (auto& queue : queues_) {
+            queue = std::make_unique<worker_queue>();
+        }
+        threads_.reserve(workers);
+        for (size_t i = 0; i < workers; ++i) {
+            threads_.emplace_back([this, i] { worker_loop(i); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        sleep_cv_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    // Number of worker threads (not counting threads that help while waiting)
+    size_t size() const noexcept
+    {
+        return threads_.size();
+    }
+
+    // Queue a task: workers push to their own deque, other threads spread round-robin
+    template <typename F>
+    void submit(F&& task)
+    {
+        size_t index = (current_pool_ == this)
+            ? current_index_
+            : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        // Counted before it is visible so a thief can never drive the counter below zero
+        pending_.fetch_add(1, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+            try {
+                queues_[index]->tasks.emplace_back(std::forward<F>(task));
+            } catch (...) {
+                // Never queued (std::function or deque allocation failed)
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                throw;
+            }
+        }
+        {
+            // Taking the sleep mutex orders this notify after a sleeper's predicate check
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+        }
+        sleep_cv_.notify_one();
+    }
+
+    // Run one queued task on the calling thread; false when every deque is empty
+    bool try_run_one()
+    {
+        size_t home = (current_pool_ == this) ? current_index_ : 0;
+        std::function<void()> task;
+        if (!take_task(home, task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+    // Process-wide pool with one worker per hardware thread besides the caller
+    static thread_pool& default_pool()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    static size_t default_worker_count() noexcept
+    {
+        unsigned hw = std::thread::hardware_concurrency();
+        return hw > 1 ? hw - 1 : 0;
+    }
+
+private:
+    struct worker_queue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    // Pop from the back of the home deque, otherwise steal from the front of another
+    bool take_task(size_t home, std::function<void()>& task)
+    {
+        if (pending_.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        {
+            worker_queue& own = *queues_[home];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        for (size_t i = 1; i < queues_.size(); ++i) {
+            worker_queue& victim = *queues_[(home + i) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void worker_loop(size_t index)
+    {
+        current_pool_ = this;
+        current_index_ = index;
+        std::function<void()> task;
+        for (;;) {
+            if (take_task(index, task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleep_cv_.wait(lock, [this] {
+                return stop_ || pending_.load(std::memory_order_acquire) != 0;
+            });
+            if (stop_ && pending_.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<worker_queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> pending_{ 0 };
+    std::atomic<size_t> next_queue_{ 0 };
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    bool stop_ = false;
+
+    // Pool and deque index of the worker running on this thread, if any
+    static inline thread_local thread_pool* current_pool_ = nullptr;
+    static inline thread_local size_t current_index_ = 0;
+};
+
+// A set of tasks submitted to a pool that can be waited for as a whole. Tasks must not
+// throw: as with the standard parallel algorithms, an escaping exception terminates.
+class task_group
+{
+public:
+    explicit task_group(thread_pool& pool) noexcept
+        : pool_(pool)
+    {}
+
+    task_group(const task_group&) = delete;
+    task_group& operator=(const task_group&) = delete;
+
+    ~task_group()
+    {
+        wait();
+    }
+
+    // Queue a task. If queueing throws (allocation failure) the task is not counted, so
+    // wait() and the destructor still return.
+    template <typename F>
+    void run(F&& task)
+    {
+        remaining_.fetch_add(1, std::memory_order_relaxed);
+        try {
+            pool_.submit([this, task = std::forward<F>(task)]() mutable noexcept {
+                task();
+                remaining_.fetch_sub(1, std::memory_order_release);
+            });
+        } catch (...) {
+            remaining_.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+    }
+
+    // Help run queued tasks (from this or any other group) until all of ours are done
+    void wait()
+    {
+        while (remaining_.load(std::memory_order_acquire) != 0) {
+            if (!pool_.try_run_one()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    thread_pool& pool_;
+    std::atomic<size_t> remaining_{ 0 };
+};
+
+}
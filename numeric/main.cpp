@@ -0,0 +1,51 @@
+//
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "numeric.hpp"
+
+int main() {
+    // Test make_signed / make_unsigned
+    std::cout << "is_same_v<make_signed_t<unsigned int>, int>: "
+              << myTypeTraits::is_same_v<myTypeTraits::make_signed_t<unsigned int>, int> << "\n"; // Expected: 1 (true)
+    std::cout << "is_same_v<make_unsigned_t<const short>, const unsigned short>: "
+              << myTypeTraits::is_same_v<myTypeTraits::make_unsigned_t<const short>, const unsigned short> << "\n"; // Expected: 1 (true)
+
+    // Test numeric_limits
+    std::cout << "numeric_limits<int16_t>::min(): " << myTypeTraits::numeric_limits<int16_t>::min() << "\n"; // Expected: -32768
+    std::cout << "numeric_limits<int16_t>::max(): " << myTypeTraits::numeric_limits<int16_t>::max() << "\n"; // Expected: 32767
+    std::cout << "numeric_limits<uint32_t>::max(): " << myTypeTraits::numeric_limits<uint32_t>::max() << "\n"; // Expected: 4294967295
+    std::cout << "is_signed_v<int>: " << myTypeTraits::is_signed_v<int> << "\n"; // Expected: 1 (true)
+    std::cout << "is_unsigned_v<int>: " << myTypeTraits::is_unsigned_v<int> << "\n"; // Expected: 0 (false)
+
+    // Test common_type
+    std::cout << "is_same_v<common_type_t<short, int, long long>, long long>: "
+              << myTypeTraits::is_same_v<myTypeTraits::common_type_t<short, int, long long>, long long> << "\n"; // Expected: 1 (true)
+
+    // Test scalar saturating arithmetic
+    std::cout << "add_sat<int16_t>(30000, 10000): " << myNumeric::add_sat<int16_t>(30000, 10000) << "\n"; // Expected: 32767
+    std::cout << "sub_sat<int32_t>(INT32_MIN, 1): " << myNumeric::sub_sat<int32_t>(INT32_MIN, 1) << "\n"; // Expected: -2147483648
+    std::cout << "add_sat<int64_t>(INT64_MAX, 1): " << myNumeric::add_sat<int64_t>(INT64_MAX, 1) << "\n"; // Expected: 9223372036854775807
+    std::cout << "sub_sat<uint64_t>(1, 2): " << myNumeric::sub_sat<uint64_t>(1, 2) << "\n"; // Expected: 0
+    std::cout << "mul_sat<int64_t>(INT64_MAX, -2): " << myNumeric::mul_sat<int64_t>(INT64_MAX, -2) << "\n"; // Expected: -9223372036854775808
+
+    // Test span kernels
+    std::vector<int16_t> a = { 32000, -32000, 100, -5 };
+    std::vector<int16_t> b = { 1000, -1000, 200, 3 };
+    std::vector<int16_t> out(a.size());
+    myNumeric::add_sat<int16_t>(a, b, out);
+    std::cout << "add_sat over span:";
+    for (int16_t v : out) {
+        std::cout << " " << v;
+    }
+    std::cout << "\n"; // Expected: 32767 -32768 300 -2
+
+    myNumeric::clamp<int16_t>(out, -100, 100);
+    std::cout << "clamp over span:";
+    for (int16_t v : out) {
+        std::cout << " " << v;
+    }
+    std::cout << "\n"; // Expected: 100 -100 100 -2
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include "../type_traits/type_traits.hpp"
+
+namespace myNumeric {
+
+// Saturating integer kernels. Every kernel computes both the wrapped result and the
+// saturated value and then selects between them, so the per-element loops contain no
+// branches and the compiler can turn them into packed min/max/blend instructions.
+
+// Integer types the kernels accept (bool is excluded, like in std::add_sat)
+template <typename T>
+concept saturatable = myTypeTraits::numeric_limits<T>::is_integer &&
+                      !myTypeTraits::is_same_v<myTypeTraits::remove_cv_t<T>, bool>;
+
+// Helper trait: the integer type with twice the width of T and the same signedness, for
+// 8- and 16-bit types only. 32- and 64-bit types get void, so add_sat and sub_sat use
+// overflow detection in their own width: widening them to 64-bit lanes keeps baseline
+// x86-64 (SSE2) from vectorizing those loops.
+template <typename T, size_t Size = sizeof(T)>
+struct wider_integer_helper
+{
+    using type = void;
+};
+
+template <typename T>
+struct wider_integer_helper<T, 1>
+{
+    using type = myTypeTraits::conditional_t<myTypeTraits::is_signed_v<T>, short, unsigned short>;
+};
+
+template <typename T>
+struct wider_integer_helper<T, 2>
+{
+    using type = myTypeTraits::conditional_t<myTypeTraits::is_signed_v<T>, int, unsigned int>;
+};
+
+// Helper alias template
+template <typename T>
+using wider_integer_t = typename wider_integer_helper<T>::type;
+
+// Helper trait: the widened type mul_sat computes in. Unlike addition and subtraction,
+// 32-bit products have no cheap same-width overflow check that vectorizes
+// (__builtin_mul_overflow keeps the loop scalar), so 32-bit types still widen to 64 bits
+// and clamp; only 64-bit types get void.
+template <typename T, size_t Size = sizeof(T)>
+struct wider_product_helper : wider_integer_helper<T, Size>
+{};
+
+template <typename T>
+struct wider_product_helper<T, 4>
+{
+    using type = myTypeTraits::conditional_t<myTypeTraits::is_signed_v<T>, long long, unsigned long long>;
+};
+
+// Helper alias template
+template <typename T>
+using wider_product_t = typename wider_product_helper<T>::type;
+
+// Clamp v into [lo, hi]; written as two selects so it lowers to min/max
+template <typename T>
+constexpr T clamp(T v, T lo, T hi) noexcept
+{
+    T r = v < lo ? lo : v;
+    return hi < r ? hi : r;
+}
+
+// Clamp a wide intermediate result into the range of T
+template <typename T, typename W>
+constexpr T saturate_cast_helper(W v) noexcept
+{
+    using limits = myTypeTraits::numeric_limits<T>;
+    return static_cast<T>(clamp<W>(v, static_cast<W>(limits::min()), static_cast<W>(limits::max())));
+}
+
+// Saturating addition
+template <saturatable T>
+constexpr T add_sat(T a, T b) noexcept
+{
+    using limits = myTypeTraits::numeric_limits<T>;
+    if constexpr (!myTypeTraits::is_void_v<wider_integer_t<T>>) {
+        using W = wider_integer_t<T>;
+        return saturate_cast_helper<T>(static_cast<W>(static_cast<W>(a) + static_cast<W>(b)));
+    } else {
+        using U = myTypeTraits::make_unsigned_t<T>;
+        T r = static_cast<T>(static_cast<U>(static_cast<U>(a) + static_cast<U>(b)));
+        if constexpr (limits::is_signed) {
+            // Overflow iff both operands have the same sign and the result's sign differs;
+            // the saturated value is max for a >= 0 and min for a < 0
+            bool overflow = ((a ^ r) & (b ^ r)) < 0;
+            T sat = static_cast<T>((a >> limits::digits) ^ limits::max());
+            return overflow ? sat : r;
+        } else {
+            return r < a ? limits::max() : r;
+        }
+    }
+}
+
+// Saturating subtraction
+template <saturatable T>
+constexpr T sub_sat(T a, T b) noexcept
+{
+    using limits = myTypeTraits::numeric_limits<T>;
+    if constexpr (!myTypeTraits::is_void_v<wider_integer_t<T>>) {
+        using W = myTypeTraits::make_signed_t<wider_integer_t<T>>;
+        return saturate_cast_helper<T>(static_cast<W>(static_cast<W>(a) - static_cast<W>(b)));
+    } else {
+        using U = myTypeTraits::make_unsigned_t<T>;
+        T r = static_cast<T>(static_cast<U>(static_cast<U>(a) - static_cast<U>(b)));
+        if constexpr (limits::is_signed) {
+            // Overflow iff the operands have different signs and the result's sign differs from a
+            bool overflow = ((a ^ b) & (a ^ r)) < 0;
+            T sat = static_cast<T>((a >> limits::digits) ^ limits::max());
+            return overflow ? sat : r;
+        } else {
+            return a < b ? T(0) : r;
+        }
+    }
+}
+
+// Saturating multiplication
+template <saturatable T>
+constexpr T mul_sat(T a, T b) noexcept
+{
+    using limits = myTypeTraits::numeric_limits<T>;
+    if constexpr (!myTypeTraits::is_void_v<wider_product_t<T>>) {
+        using W = wider_product_t<T>;
+        return saturate_cast_helper<T>(static_cast<W>(static_cast<W>(a) * static_cast<W>(b)));
+    } else {
+        T r{};
+        bool overflow = __builtin_mul_overflow(a, b, &r);
+        T sat = limits::max();
+        if constexpr (limits::is_signed) {
+            // Operands of different signs overflow towards min
+            sat = static_cast<T>(((a ^ b) >> limits::digits) ^ limits::max());
+        }
+        return overflow ? sat : r;
+    }
+}
+
+// Span kernels. a.size() elements are processed; b and out must be at least that long,
+// and out may alias one of the inputs exactly.
+
+// out[i] = add_sat(a[i], b[i])
+template <saturatable T>
+constexpr void add_sat(std::span<const T> a, std::span<const T> b, std::span<T> out) noexcept
+{
+    const size_t n = a.size();
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = add_sat(a[i], b[i]);
+    }
+}
+
+// out[i] = sub_sat(a[i], b[i])
+template <saturatable T>
+constexpr void sub_sat(std::span<const T> a, std::span<const T> b, std::span<T> out) noexcept
+{
+    const size_t n = a.size();
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = sub_sat(a[i], b[i]);
+    }
+}
+
+// out[i] = mul_sat(a[i], b[i])
+template <saturatable T>
+constexpr void mul_sat(std::span<const T> a, std::span<const T> b, std::span<T> out) noexcept
+{
+    const size_t n = a.size();
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = mul_sat(a[i], b[i]);
+    }
+}
+
+// In-place clamp of every element into [lo, hi]
+template <typename T>
+    requires myTypeTraits::is_arithmetic_v<T>
+constexpr void clamp(std::span<T> values, T lo, T hi) noexcept
+{
+    const size_t n = values.size();
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = clamp(values[i], lo, hi);
+    }
+}
+
+}
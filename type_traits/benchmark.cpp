@@ -0,0 +1,555 @@
+// Microbenchmark for the trait-dispatched memory operations in algorithm/memory.hpp.
+// Every operation (copy, relocate, hash, fill) runs through its dispatched entry point and
+// through the forced generic path for each sample type and buffer size, and the results
+// are written as JSON so that runs from different commits can be diffed.
+//
+// Usage: benchmark [--min-bytes N] [--max-bytes N] [--samples K] [--min-sample-ms MS]
+//                  [--warmup-ms MS] [--perf] [--output FILE]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include "../algorithm/memory.hpp"
+#include "test_types.hpp"
+
+// Element hashes for the generic hash path (found by argument-dependent lookup)
+uint64_t hash_value(const TrivialStruct& value)
+{
+    return myAlgorithm::hash_value(value.x);
+}
+
+uint64_t hash_value(const PodType& value)
+{
+    return myAlgorithm::hash_combine(myAlgorithm::hash_value(value.x), myAlgorithm::hash_value(value.y));
+}
+
+uint64_t hash_value(const NonTrivialStruct& value)
+{
+    return myAlgorithm::hash_value(value.x);
+}
+
+uint64_t hash_value(const NonTriviallyCopyable& value)
+{
+    return myAlgorithm::hash_value(value.x);
+}
+
+struct options
+{
+    size_t min_bytes = 16;
+    size_t max_bytes = size_t(1) << 30;
+    int samples = 10;
+    double min_sample_ms = 10.0;
+    double warmup_ms = 20.0;
+    bool perf = false;
+    std::string output;
+};
+
+// Hardware counters of the calling thread via perf_event_open (Linux only). When the
+// counters cannot be opened (other OS, no permission) available() is false and the
+// benchmark reports them as null.
+class perf_counters
+{
+public:
+    static constexpr int count = 4;
+    static constexpr const char* names[count] = { "cycles", "instructions", "cache_misses", "branch_misses" };
+
+    explicit perf_counters(bool enabled)
+    {
+#if defined(__linux__)
+        if (!enabled) {
+            return;
+        }
+        const uint64_t configs[count] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                          PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+        for (int i = 0; i < count; ++i) {
+            perf_event_attr attr{};
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = configs[i];
+            attr.disabled = i == 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fds_[0], 0));
+            if (fd < 0) {
+                std::cerr << "perf_event_open failed for " << names[i] << ": " << std::strerror(errno)
+                          << "; hardware counters disabled\n";
+                close_all();
+                return;
+            }
+            fds_[i] = fd;
+        }
+        available_ = true;
+#else
+        if (enabled) {
+            std::cerr << "hardware counters need perf_event_open (Linux); disabled\n";
+        }
+#endif
+    }
+
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+    ~perf_counters()
+    {
+        close_all();
+    }
+
+    bool available() const noexcept
+    {
+        return available_;
+    }
+
+    void start() noexcept
+    {
+#if defined(__linux__)
+        if (available_) {
+            ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    // Stops counting and adds the counts since start() to totals
+    void stop(uint64_t (&totals)[count]) noexcept
+    {
+#if defined(__linux__)
+        if (available_) {
+            ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+            uint64_t buffer[1 + count] = {};
+            if (read(fds_[0], buffer, sizeof(buffer)) == static_cast<ssize_t>(sizeof(buffer))) {
+                for (int i = 0; i < count; ++i) {
+                    totals[i] += buffer[1 + i];
+                }
+            }
+        }
+#else
+        static_cast<void>(totals);
+#endif
+    }
+
+private:
+    void close_all() noexcept
+    {
+#if defined(__linux__)
+        for (int& fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+#endif
+        available_ = false;
+    }
+
+    int fds_[count] = { -1, -1, -1, -1 };
+    bool available_ = false;
+};
+
+// Forces the compiler to assume memory was read and written, so results are not elided
+inline void clobber_memory()
+{
+    asm volatile("" : : : "memory");
+}
+
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+struct measurement
+{
+    std::vector<double> ns_per_op;
+    size_t iterations = 0;
+    bool has_counters = false;
+    double counters[perf_counters::count] = {};
+};
+
+// Warms op up, picks an iteration count that makes one sample last at least
+// min_sample_ms, then times `samples` samples of that many calls
+template <typename Op>
+measurement measure(const options& opts, perf_counters& perf, Op op)
+{
+    using clock = std::chrono::steady_clock;
+    auto elapsed_ms = [](clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    };
+
+    clock::time_point warmup_start = clock::now();
+    do {
+        op();
+        clobber_memory();
+    } while (elapsed_ms(warmup_start) < opts.warmup_ms);
+
+    // Each candidate count is timed twice and the faster run decides, so a single
+    // preemption does not end calibration early
+    size_t iterations = 1;
+    for (;;) {
+        double fastest_ms = 0;
+        for (int attempt = 0; attempt < 2; ++attempt) {
+            clock::time_point start = clock::now();
+            for (size_t i = 0; i < iterations; ++i) {
+                op();
+                clobber_memory();
+            }
+            double ms = elapsed_ms(start);
+            fastest_ms = attempt == 0 ? ms : std::min(fastest_ms, ms);
+        }
+        if (fastest_ms >= opts.min_sample_ms || iterations >= (size_t(1) << 30)) {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    measurement result;
+    result.iterations = iterations;
+    uint64_t totals[perf_counters::count] = {};
+    for (int s = 0; s < opts.samples; ++s) {
+        perf.start();
+        clock::time_point start = clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            op();
+            clobber_memory();
+        }
+        double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+        perf.stop(totals);
+        result.ns_per_op.push_back(ns / static_cast<double>(iterations));
+    }
+    if (perf.available()) {
+        result.has_counters = true;
+        double ops = static_cast<double>(iterations) * opts.samples;
+        for (int i = 0; i < perf_counters::count; ++i) {
+            result.counters[i] = static_cast<double>(totals[i]) / ops;
+        }
+    }
+    return result;
+}
+
+struct statistics
+{
+    double median;
+    double mean;
+    double stddev;
+    double min;
+    double max;
+};
+
+statistics summarize(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    statistics s{};
+    size_t n = values.size();
+    s.median = n % 2 == 1 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+    s.min = values.front();
+    s.max = values.back();
+    for (double v : values) {
+        s.mean += v;
+    }
+    s.mean /= static_cast<double>(n);
+    for (double v : values) {
+        s.stddev += (v - s.mean) * (v - s.mean);
+    }
+    s.stddev = n > 1 ? std::sqrt(s.stddev / static_cast<double>(n - 1)) : 0.0;
+    return s;
+}
+
+// One JSON object per (operation, type, size, path). An operation a type cannot run gets an
+// entry with "skipped": true and a reason instead of being left out.
+class json_report
+{
+public:
+    void add(const char* operation, const char* type, size_t bytes, size_t elements, const char* path,
+             bool fast_path_eligible, const measurement& m)
+    {
+        statistics s = summarize(m.ns_per_op);
+        std::ostringstream out;
+        out.precision(6);
+        begin_entry(out, operation, type, bytes, elements, path, fast_path_eligible);
+        out << ", \"skipped\": false, \"iterations\": " << m.iterations << ", \"samples\": " << m.ns_per_op.size()
+            << ", \"median_ns\": " << s.median << ", \"mean_ns\": " << s.mean
+            << ", \"stddev_ns\": " << s.stddev << ", \"min_ns\": " << s.min << ", \"max_ns\": " << s.max
+            << ", \"bytes_per_second\": " << (s.median > 0 ? static_cast<double>(bytes) * 1e9 / s.median : 0.0)
+            << ", \"counters\": ";
+        if (m.has_counters) {
+            out << "{";
+            for (int i = 0; i < perf_counters::count; ++i) {
+                out << (i == 0 ? "" : ", ") << "\"" << perf_counters::names[i] << "\": " << m.counters[i];
+            }
+            out << "}";
+        } else {
+            out << "null";
+        }
+        out << "}";
+        entries_.push_back(out.str());
+    }
+
+    void add_skipped(const char* operation, const char* type, size_t bytes, size_t elements, const char* path,
+                     bool fast_path_eligible, const char* reason)
+    {
+        std::ostringstream out;
+        begin_entry(out, operation, type, bytes, elements, path, fast_path_eligible);
+        out << ", \"skipped\": true, \"reason\": \"" << reason << "\"}";
+        entries_.push_back(out.str());
+    }
+
+    void write(std::ostream& out, const options& opts) const
+    {
+        out << "{\n  \"benchmark\": \"type_traits\",\n";
+#if defined(__VERSION__)
+        out << "  \"compiler\": \"" << __VERSION__ << "\",\n";
+#endif
+        out << "  \"samples\": " << opts.samples << ",\n  \"min_sample_ms\": " << opts.min_sample_ms
+            << ",\n  \"results\": [\n";
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            out << entries_[i] << (i + 1 < entries_.size() ? ",\n" : "\n");
+        }
+        out << "  ]\n}\n";
+    }
+
+private:
+    // Fields shared by measured and skipped entries
+    static void begin_entry(std::ostringstream& out, const char* operation, const char* type, size_t bytes,
+                            size_t elements, const char* path, bool fast_path_eligible)
+    {
+        out << "    {\"operation\": \"" << operation << "\", \"type\": \"" << type
+            << "\", \"bytes\": " << bytes << ", \"elements\": " << elements
+            << ", \"path\": \"" << path << "\", \"fast_path_eligible\": " << (fast_path_eligible ? "true" : "false");
+    }
+
+    std::vector<std::string> entries_;
+};
+
+// Cache-line aligned storage for n objects of type T; objects are constructed by the caller
+template <typename T>
+class buffer
+{
+public:
+    explicit buffer(size_t n)
+        : data_(static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(64)))), size_(n)
+    {
+        // Touch every page so that page faults are not part of the first measurement
+        std::memset(static_cast<void*>(data_), 0, n * sizeof(T));
+    }
+
+    buffer(const buffer&) = delete;
+    buffer& operator=(const buffer&) = delete;
+
+    ~buffer()
+    {
+        ::operator delete(static_cast<void*>(data_), std::align_val_t(64));
+    }
+
+    T* begin() const noexcept { return data_; }
+    T* end() const noexcept { return data_ + size_; }
+
+private:
+    T* data_;
+    size_t size_;
+};
+
+template <typename T>
+void construct_all(T* first, T* last)
+{
+    for (size_t i = 0; first != last; ++first, ++i) {
+        T* object = ::new (static_cast<void*>(first)) T();
+        object->x = static_cast<int>(i);
+        if constexpr (requires { object->y; }) {
+            object->y = static_cast<double>(i) * 0.5;
+        }
+    }
+}
+
+template <typename T>
+void destroy_all(T* first, T* last)
+{
+    for (; first != last; ++first) {
+        first->~T();
+    }
+}
+
+// Compares the human-readable dispatched and generic medians
+void print_row(const char* operation, const char* type, size_t bytes, const measurement& dispatched,
+               const measurement& generic)
+{
+    double fast = summarize(dispatched.ns_per_op).median;
+    double slow = summarize(generic.ns_per_op).median;
+    std::fprintf(stderr, "%-9s %-20s %12zu %14.1f %14.1f %8.2fx\n", operation, type, bytes, fast, slow,
+                 fast > 0 ? slow / fast : 0.0);
+}
+
+void print_skipped_row(const char* operation, const char* type, size_t bytes, const char* reason)
+{
+    std::fprintf(stderr, "%-9s %-20s %12zu skipped: %s\n", operation, type, bytes, reason);
+}
+
+template <typename T>
+void run_type(const char* type, const options& opts, perf_counters& perf, json_report& report)
+{
+    constexpr bool trivially_copyable = myTypeTraits::is_trivially_copyable_v<T>;
+    constexpr bool bitwise_assignable = myAlgorithm::is_bitwise_assignable_v<T>;
+    constexpr bool unique_representation = myTypeTraits::has_unique_object_representations_v<T>;
+    constexpr bool relocatable = requires(T& t) { T(std::move(t)); };
+
+    for (size_t requested = opts.min_bytes; requested <= opts.max_bytes; requested *= 4) {
+        const size_t n = std::max<size_t>(1, requested / sizeof(T));
+        const size_t bytes = n * sizeof(T);
+        try {
+            buffer<T> src(n);
+            buffer<T> dst(n);
+            construct_all(src.begin(), src.end());
+            construct_all(dst.begin(), dst.end());
+
+            auto report_pair = [&](const char* operation, bool eligible, const measurement& dispatched,
+                                   const measurement& generic) {
+                report.add(operation, type, bytes, n, "dispatched", eligible, dispatched);
+                report.add(operation, type, bytes, n, "generic", eligible, generic);
+                print_row(operation, type, bytes, dispatched, generic);
+            };
+
+            // copy
+            {
+                measurement dispatched = measure(opts, perf, [&] {
+                    do_not_optimize(myAlgorithm::copy(src.begin(), src.end(), dst.begin()));
+                });
+                measurement generic = measure(opts, perf, [&] {
+                    do_not_optimize(myAlgorithm::copy_generic(src.begin(), src.end(), dst.begin()));
+                });
+                report_pair("copy", bitwise_assignable, dispatched, generic);
+            }
+
+            // relocate: back and forth between the buffers, so dst starts out uninitialized
+            if constexpr (relocatable) {
+                destroy_all(dst.begin(), dst.end());
+                bool in_src = true;
+                auto relocate_with = [&](auto relocate_fn) {
+                    return measure(opts, perf, [&] {
+                        if (in_src) {
+                            do_not_optimize(relocate_fn(src.begin(), src.end(), dst.begin()));
+                        } else {
+                            do_not_optimize(relocate_fn(dst.begin(), dst.end(), src.begin()));
+                        }
+                        in_src = !in_src;
+                    });
+                };
+                measurement dispatched = relocate_with([](T* f, T* l, T* d) { return myAlgorithm::relocate(f, l, d); });
+                measurement generic = relocate_with([](T* f, T* l, T* d) { return myAlgorithm::relocate_generic(f, l, d); });
+                report_pair("relocate", trivially_copyable, dispatched, generic);
+                if (!in_src) {
+                    myAlgorithm::relocate(dst.begin(), dst.end(), src.begin());
+                }
+                construct_all(dst.begin(), dst.end());
+            } else {
+                const char* reason = "not move constructible";
+                report.add_skipped("relocate", type, bytes, n, "dispatched", trivially_copyable, reason);
+                report.add_skipped("relocate", type, bytes, n, "generic", trivially_copyable, reason);
+                print_skipped_row("relocate", type, bytes, reason);
+            }
+
+            // hash
+            {
+                measurement dispatched = measure(opts, perf, [&] {
+                    do_not_optimize(myAlgorithm::hash_range(src.begin(), src.end()));
+                });
+                measurement generic = measure(opts, perf, [&] {
+                    do_not_optimize(myAlgorithm::hash_range_generic(src.begin(), src.end()));
+                });
+                report_pair("hash", unique_representation, dispatched, generic);
+            }
+
+            // fill with a value-initialized (all-zero) object, the common "clear" case
+            {
+                const T value{};
+                measurement dispatched = measure(opts, perf, [&] {
+                    myAlgorithm::fill(dst.begin(), dst.end(), value);
+                });
+                measurement generic = measure(opts, perf, [&] {
+                    myAlgorithm::fill_generic(dst.begin(), dst.end(), value);
+                });
+                report_pair("fill", bitwise_assignable, dispatched, generic);
+            }
+
+            destroy_all(src.begin(), src.end());
+            destroy_all(dst.begin(), dst.end());
+        } catch (const std::bad_alloc&) {
+            std::cerr << "skipping " << type << " at " << bytes << " bytes: allocation failed\n";
+        }
+        if (requested > opts.max_bytes / 4) {
+            break;
+        }
+    }
+}
+
+bool parse_options(int argc, char** argv, options& opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char* value = nullptr;
+        if (arg == "--perf") {
+            opts.perf = true;
+        } else if (arg == "--min-bytes" && (value = next())) {
+            opts.min_bytes = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--max-bytes" && (value = next())) {
+            opts.max_bytes = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--samples" && (value = next())) {
+            opts.samples = std::atoi(value);
+        } else if (arg == "--min-sample-ms" && (value = next())) {
+            opts.min_sample_ms = std::atof(value);
+        } else if (arg == "--warmup-ms" && (value = next())) {
+            opts.warmup_ms = std::atof(value);
+        } else if (arg == "--output" && (value = next())) {
+            opts.output = value;
+        } else {
+            return false;
+        }
+    }
+    return opts.min_bytes > 0 && opts.min_bytes <= opts.max_bytes && opts.samples > 0;
+}
+
+int main(int argc, char** argv) {
+    options opts;
+    if (!parse_options(argc, argv, opts)) {
+        std::cerr << "usage: " << argv[0] << " [--min-bytes N] [--max-bytes N] [--samples K]"
+                  << " [--min-sample-ms MS] [--warmup-ms MS] [--perf] [--output FILE]\n";
+        return 2;
+    }
+
+    perf_counters perf(opts.perf);
+    json_report report;
+
+    std::fprintf(stderr, "%-9s %-20s %12s %14s %14s %9s\n", "operation", "type", "bytes", "dispatched ns",
+                 "generic ns", "speedup");
+    run_type<TrivialStruct>("TrivialStruct", opts, perf, report);
+    run_type<PodType>("PodType", opts, perf, report);
+    run_type<NonTrivialStruct>("NonTrivialStruct", opts, perf, report);
+    run_type<NonTriviallyCopyable>("NonTriviallyCopyable", opts, perf, report);
+
+    if (opts.output.empty()) {
+        report.write(std::cout, opts);
+    } else {
+        std::ofstream file(opts.output);
+        report.write(file, opts);
+        if (!file) {
+            std::cerr << "failed to write " << opts.output << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
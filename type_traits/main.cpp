@@ -1,37 +1,6 @@
 #include <iostream>
 #include "type_traits.hpp" // Replace with the actual header file name if needed
-
-struct TrivialStruct {
-    int x;
-};
-
-struct NonTrivialStruct {
-    NonTrivialStruct() : x(0) {}
-    NonTrivialStruct(const NonTrivialStruct&) = delete; // Non-trivial copy constructor
-    int x;
-};
-
-struct StandardLayout {
-    int x;
-    double y;
-};
-
-struct NonStandardLayout {
-    virtual void func() {}
-    int x;
-};
-
-
-struct PodType {
-    int x;
-    double y;
-};
-
-struct NonPodType {
-    NonPodType() = default; // User-defined default constructor
-    int x;
-    double y;
-};
+#include "test_types.hpp"
 
 template <typename T>
 typename myTypeTraits::enable_if<myTypeTraits::is_integral<T>::value, T>::type
@@ -121,6 +90,9 @@ int main() {
     std::cout << "is_trivial<TrivialStruct>::value: " << std::is_trivial<TrivialStruct>::value << "\n"; // Expected: 1 (true)
     std::cout << "is_trivial<NonTrivialStruct>::value: " << std::is_trivial<NonTrivialStruct>::value << "\n"; // Expected: 0 (false)
 
+    std::cout << "is_trivially_copy_assignable_v<TrivialStruct>: " << myTypeTraits::is_trivially_copy_assignable_v<TrivialStruct> << "\n"; // Expected: 1 (true)
+    std::cout << "is_trivially_copy_assignable_v<NonTriviallyCopyable>: " << myTypeTraits::is_trivially_copy_assignable_v<NonTriviallyCopyable> << "\n"; // Expected: 0 (false)
+
     std::cout << "is_standard_layout_v<int>: " << myTypeTraits::is_standard_layout_v<int> << "\n"; // Expected: 1 (true)
     std::cout << "is_standard_layout_v<StandardLayout>: " << myTypeTraits::is_standard_layout_v<StandardLayout> << "\n"; // Expected: 1 (true)
     std::cout << "is_standard_layout_v<NonStandardLayout>: " << myTypeTraits::is_standard_layout_v<NonStandardLayout> << "\n"; // Expected: 0 (false)
@@ -0,0 +1,50 @@
+#pragma once
+
+// Sample types exercised by the demo (main.cpp) and the benchmark (benchmark.cpp)
+
+struct TrivialStruct {
+    int x;
+};
+
+// Not trivial (user-provided default constructor), but still trivially copyable: the
+// deleted copy constructor, implicit copy assignment and destructor are all trivial
+struct NonTrivialStruct {
+    NonTrivialStruct() : x(0) {}
+    NonTrivialStruct(const NonTrivialStruct&) = delete; // Non-trivial copy constructor
+    int x;
+};
+
+struct NonTriviallyCopyable {
+    NonTriviallyCopyable() : x(0) {}
+    NonTriviallyCopyable(const NonTriviallyCopyable& other) : x(other.x) {} // User-provided copy
+    NonTriviallyCopyable(NonTriviallyCopyable&& other) noexcept : x(other.x) {} // User-provided move
+    NonTriviallyCopyable& operator=(const NonTriviallyCopyable& other)
+    {
+        x = other.x;
+        return *this;
+    }
+    ~NonTriviallyCopyable() {} // User-provided destructor
+    int x;
+};
+
+struct StandardLayout {
+    int x;
+    double y;
+};
+
+struct NonStandardLayout {
+    virtual void func() {}
+    int x;
+};
+
+
+struct PodType {
+    int x;
+    double y;
+};
+
+struct NonPodType {
+    NonPodType() = default; // User-defined default constructor
+    int x;
+    double y;
+};
@@ -1,3 +1,5 @@
+#pragma once
+
 #include <iostream>
 
 namespace myTypeTraits {
@@ -7,8 +9,8 @@ template <typename T, T val>
 struct integral_constant
 {
     static constexpr T value = val;
-    using type = T;
-    using value_type = integral_constant;
+    using value_type = T;
+    using type = integral_constant;
     // Conversion operator to retrieve the value
     constexpr operator value_type () const noexcept
     {
@@ -403,6 +405,15 @@ struct is_trivially_copyable : std::integral_constant<bool, __is_trivially_copya
 template <typename T>
 inline constexpr bool is_trivially_copyable_v = is_trivially_copyable<T>::value;
 
+// is_trivially_copy_assignable trait
+template <typename T>
+struct is_trivially_copy_assignable : std::integral_constant<bool, __is_trivially_assignable(T&, const T&)>
+{};
+
+// Inline variable for easy access to is_trivially_copy_assignable value
+template <typename T>
+inline constexpr bool is_trivially_copy_assignable_v = is_trivially_copy_assignable<T>::value;
+
 
 // is_standard_layout trait
 template <typename T>
@@ -422,6 +433,17 @@ struct is_pod : std::integral_constant<bool, __is_pod(T)>
 template <typename T>
 inline constexpr bool is_pod_v = is_pod<T>::value;
 
+// has_unique_object_representations trait (using compiler intrinsic):
+// equal values of T are guaranteed to have equal object representations
+template <typename T>
+struct has_unique_object_representations
+    : std::integral_constant<bool, __has_unique_object_representations(remove_cv_t<T>)>
+{};
+
+// Inline variable for easy access to has_unique_object_representations value
+template <typename T>
+inline constexpr bool has_unique_object_representations_v = has_unique_object_representations<T>::value;
+
 // Adds the const qualifier to a type T
 template <typename T>
 struct add_const 
@@ -599,11 +621,293 @@ struct conditional<false, T, F>
 template<bool B, typename T, typename F>
 using conditional_t = typename conditional<B, T, F>::type;
 
+// Copies the cv-qualifiers of From onto To
+template <typename From, typename To>
+struct copy_cv
+{
+    using type = To;
+};
 
+template <typename From, typename To>
+struct copy_cv<const From, To>
+{
+    using type = const To;
+};
 
+template <typename From, typename To>
+struct copy_cv<volatile From, To>
+{
+    using type = volatile To;
+};
+
+template <typename From, typename To>
+struct copy_cv<const volatile From, To>
+{
+    using type = const volatile To;
+};
 
+// Helper alias template
+template <typename From, typename To>
+using copy_cv_t = typename copy_cv<From, To>::type;
+
+// Helper trait mapping a cv-unqualified integer type to the signed type of the same rank
+// (left undefined for bool and non-integer types, so make_signed rejects them)
+template <typename T>
+struct make_signed_helper;
+
+template <> struct make_signed_helper<char>               { using type = signed char; };
+template <> struct make_signed_helper<signed char>        { using type = signed char; };
+template <> struct make_signed_helper<unsigned char>      { using type = signed char; };
+template <> struct make_signed_helper<short>              { using type = short; };
+template <> struct make_signed_helper<unsigned short>     { using type = short; };
+template <> struct make_signed_helper<int>                { using type = int; };
+template <> struct make_signed_helper<unsigned int>       { using type = int; };
+template <> struct make_signed_helper<long>               { using type = long; };
+template <> struct make_signed_helper<unsigned long>      { using type = long; };
+template <> struct make_signed_helper<long long>          { using type = long long; };
+template <> struct make_signed_helper<unsigned long long> { using type = long long; };
+
+// Character types map to the smallest signed integer type of the same size
+template <size_t Size>
+struct make_signed_by_size_helper;
+
+template <> struct make_signed_by_size_helper<1> { using type = signed char; };
+template <> struct make_signed_by_size_helper<2> { using type = short; };
+template <> struct make_signed_by_size_helper<4> { using type = int; };
+template <> struct make_signed_by_size_helper<8> { using type = long long; };
+
+template <> struct make_signed_helper<wchar_t>  : make_signed_by_size_helper<sizeof(wchar_t)> {};
+template <> struct make_signed_helper<char8_t>  : make_signed_by_size_helper<sizeof(char8_t)> {};
+template <> struct make_signed_helper<char16_t> : make_signed_by_size_helper<sizeof(char16_t)> {};
+template <> struct make_signed_helper<char32_t> : make_signed_by_size_helper<sizeof(char32_t)> {};
+
+// Make Signed Type Trait (cv-qualifiers of T are preserved)
+template <typename T>
+struct make_signed
+{
+    using type = copy_cv_t<T, typename make_signed_helper<remove_cv_t<T>>::type>;
+};
+
+// Helper alias template
+template <typename T>
+using make_signed_t = typename make_signed<T>::type;
 
+// Helper trait mapping a cv-unqualified integer type to the unsigned type of the same rank
+template <typename T>
+struct make_unsigned_helper;
+
+template <> struct make_unsigned_helper<char>               { using type = unsigned char; };
+template <> struct make_unsigned_helper<signed char>        { using type = unsigned char; };
+template <> struct make_unsigned_helper<unsigned char>      { using type = unsigned char; };
+template <> struct make_unsigned_helper<short>              { using type = unsigned short; };
+template <> struct make_unsigned_helper<unsigned short>     { using type = unsigned short; };
+template <> struct make_unsigned_helper<int>                { using type = unsigned int; };
+template <> struct make_unsigned_helper<unsigned int>       { using type = unsigned int; };
+template <> struct make_unsigned_helper<long>               { using type = unsigned long; };
+template <> struct make_unsigned_helper<unsigned long>      { using type = unsigned long; };
+template <> struct make_unsigned_helper<long long>          { using type = unsigned long long; };
+template <> struct make_unsigned_helper<unsigned long long> { using type = unsigned long long; };
+
+// Character types map to the smallest unsigned integer type of the same size
+template <size_t Size>
+struct make_unsigned_by_size_helper;
+
+template <> struct make_unsigned_by_size_helper<1> { using type = unsigned char; };
+template <> struct make_unsigned_by_size_helper<2> { using type = unsigned short; };
+template <> struct make_unsigned_by_size_helper<4> { using type = unsigned int; };
+template <> struct make_unsigned_by_size_helper<8> { using type = unsigned long long; };
+
+template <> struct make_unsigned_helper<wchar_t>  : make_unsigned_by_size_helper<sizeof(wchar_t)> {};
+template <> struct make_unsigned_helper<char8_t>  : make_unsigned_by_size_helper<sizeof(char8_t)> {};
+template <> struct make_unsigned_helper<char16_t> : make_unsigned_by_size_helper<sizeof(char16_t)> {};
+template <> struct make_unsigned_helper<char32_t> : make_unsigned_by_size_helper<sizeof(char32_t)> {};
+
+// Make Unsigned Type Trait (cv-qualifiers of T are preserved)
+template <typename T>
+struct make_unsigned
+{
+    using type = copy_cv_t<T, typename make_unsigned_helper<remove_cv_t<T>>::type>;
+};
+
+// Helper alias template
+template <typename T>
+using make_unsigned_t = typename make_unsigned<T>::type;
+
+// Primary template: types without limits report is_specialized == false
+template <typename T>
+struct numeric_limits
+{
+    static constexpr bool is_specialized = false;
+    static constexpr bool is_signed = false;
+    static constexpr bool is_integer = false;
+    static constexpr int digits = 0;
+    static constexpr T min() noexcept { return T(); }
+    static constexpr T max() noexcept { return T(); }
+    static constexpr T lowest() noexcept { return T(); }
+};
+
+// Limits shared by every integer type that has a make_unsigned mapping
+template <typename T>
+struct integer_limits_helper
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = T(-1) < T(0);
+    static constexpr bool is_integer = true;
+    static constexpr int digits = static_cast<int>(sizeof(T) * __CHAR_BIT__) - is_signed;
+    static constexpr T max() noexcept
+    {
+        // All value bits set: the sign bit is shifted out for signed types
+        return T(make_unsigned_t<T>(~make_unsigned_t<T>(0)) >> is_signed);
+    }
+    static constexpr T min() noexcept
+    {
+        // Two's complement: the minimum is one below the negated maximum
+        return is_signed ? T(-max() - 1) : T(0);
+    }
+    static constexpr T lowest() noexcept
+    {
+        return min();
+    }
+};
 
+template <> struct numeric_limits<char>               : integer_limits_helper<char> {};
+template <> struct numeric_limits<signed char>        : integer_limits_helper<signed char> {};
+template <> struct numeric_limits<unsigned char>      : integer_limits_helper<unsigned char> {};
+template <> struct numeric_limits<short>              : integer_limits_helper<short> {};
+template <> struct numeric_limits<unsigned short>     : integer_limits_helper<unsigned short> {};
+template <> struct numeric_limits<int>                : integer_limits_helper<int> {};
+template <> struct numeric_limits<unsigned int>       : integer_limits_helper<unsigned int> {};
+template <> struct numeric_limits<long>               : integer_limits_helper<long> {};
+template <> struct numeric_limits<unsigned long>      : integer_limits_helper<unsigned long> {};
+template <> struct numeric_limits<long long>          : integer_limits_helper<long long> {};
+template <> struct numeric_limits<unsigned long long> : integer_limits_helper<unsigned long long> {};
+template <> struct numeric_limits<wchar_t>            : integer_limits_helper<wchar_t> {};
+template <> struct numeric_limits<char8_t>            : integer_limits_helper<char8_t> {};
+template <> struct numeric_limits<char16_t>           : integer_limits_helper<char16_t> {};
+template <> struct numeric_limits<char32_t>           : integer_limits_helper<char32_t> {};
+
+// Specialization for bool
+template <>
+struct numeric_limits<bool>
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = false;
+    static constexpr bool is_integer = true;
+    static constexpr int digits = 1;
+    static constexpr bool min() noexcept { return false; }
+    static constexpr bool max() noexcept { return true; }
+    static constexpr bool lowest() noexcept { return false; }
+};
+
+// Floating point limits (using compiler predefined macros)
+template <>
+struct numeric_limits<float>
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr int digits = __FLT_MANT_DIG__;
+    static constexpr float min() noexcept { return __FLT_MIN__; }
+    static constexpr float max() noexcept { return __FLT_MAX__; }
+    static constexpr float lowest() noexcept { return -__FLT_MAX__; }
+    static constexpr float epsilon() noexcept { return __FLT_EPSILON__; }
+};
+
+template <>
+struct numeric_limits<double>
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr int digits = __DBL_MANT_DIG__;
+    static constexpr double min() noexcept { return __DBL_MIN__; }
+    static constexpr double max() noexcept { return __DBL_MAX__; }
+    static constexpr double lowest() noexcept { return -__DBL_MAX__; }
+    static constexpr double epsilon() noexcept { return __DBL_EPSILON__; }
+};
+
+template <>
+struct numeric_limits<long double>
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr int digits = __LDBL_MANT_DIG__;
+    static constexpr long double min() noexcept { return __LDBL_MIN__; }
+    static constexpr long double max() noexcept { return __LDBL_MAX__; }
+    static constexpr long double lowest() noexcept { return -__LDBL_MAX__; }
+    static constexpr long double epsilon() noexcept { return __LDBL_EPSILON__; }
+};
+
+// cv-qualified types share the limits of the unqualified type
+template <typename T>
+struct numeric_limits<const T> : numeric_limits<T>
+{};
+
+template <typename T>
+struct numeric_limits<volatile T> : numeric_limits<T>
+{};
+
+template <typename T>
+struct numeric_limits<const volatile T> : numeric_limits<T>
+{};
+
+// Is Signed Type Trait (true for signed integers and floating point types)
+template <typename T>
+struct is_signed : bool_constant<numeric_limits<T>::is_specialized && numeric_limits<T>::is_signed>
+{};
+
+// Inline variable for easy access to is_signed value
+template <typename T>
+inline constexpr bool is_signed_v = is_signed<T>::value;
+
+// Is Unsigned Type Trait (true for unsigned integers and bool)
+template <typename T>
+struct is_unsigned : bool_constant<numeric_limits<T>::is_integer && !numeric_limits<T>::is_signed>
+{};
+
+// Inline variable for easy access to is_unsigned value
+template <typename T>
+inline constexpr bool is_unsigned_v = is_unsigned<T>::value;
+
+// Declval: unevaluated-only access to a value of type T
+template <typename T>
+add_rvalue_reference_t<T> declval() noexcept;
+
+// Common Type Trait: no member type when the types have no common type
+template <typename... Ts>
+struct common_type
+{};
+
+// Single type: the common type of T with itself
+template <typename T>
+struct common_type<T> : common_type<T, T>
+{};
+
+// Two types: the (cv- and reference-stripped) type of the conditional operator
+template <typename T, typename U>
+    requires requires { false ? declval<T>() : declval<U>(); }
+struct common_type<T, U>
+{
+    using type = remove_cv_t<remove_reference_t<decltype(false ? declval<T>() : declval<U>())>>;
+};
+
+// Three or more types: fold from the left
+template <typename T, typename U, typename V, typename... Rest>
+    requires requires { typename common_type<T, U>::type; }
+struct common_type<T, U, V, Rest...> : common_type<typename common_type<T, U>::type, V, Rest...>
+{};
+
+// Helper alias template
+template <typename... Ts>
+using common_type_t = typename common_type<Ts...>::type;
+
+// Is Constant Evaluated (using compiler intrinsic): true while the call is being
+// evaluated at compile time, letting constexpr functions pick a runtime-only fast path
+constexpr bool is_constant_evaluated() noexcept
+{
+    return __builtin_is_constant_evaluated();
+}
 
 }
 //
@@ -0,0 +1,44 @@
+// Compile-time cost of make_index_sequence and of static_for for a large N, measured
+// separately. Built by measure_compile_time.sh with -DSEQUENCE_SIZE=N and one of
+// -DBENCHMARK_SEQUENCE (optionally with -DMYUTILITY_NO_BUILTIN_INTEGER_SEQ) or
+// -DBENCHMARK_STATIC_FOR; only compilation is timed.
+#include "utility.hpp"
+
+#ifndef SEQUENCE_SIZE
+#define SEQUENCE_SIZE 10000
+#endif
+
+constexpr size_t N = SEQUENCE_SIZE;
+
+#if defined(BENCHMARK_SEQUENCE)
+// Sum of the indices of a sequence, expanded as a single pack into an array
+template <size_t... Is>
+constexpr size_t sequence_sum(myUtility::index_sequence<Is...>)
+{
+    const size_t values[] = { Is... };
+    size_t sum = 0;
+    for (size_t value : values) {
+        sum += value;
+    }
+    return sum;
+}
+
+static_assert(myUtility::make_index_sequence<N>::size() == N);
+static_assert(sequence_sum(myUtility::make_index_sequence<N>{}) == N * (N - 1) / 2);
+#endif
+
+#if defined(BENCHMARK_STATIC_FOR)
+// The same sum through a fully unrolled static_for
+constexpr size_t static_for_sum()
+{
+    size_t sum = 0;
+    myUtility::static_for<N>([&](size_t i) { sum += i; });
+    return sum;
+}
+
+static_assert(static_for_sum() == N * (N - 1) / 2);
+#endif
+
+int main() {
+    return 0;
+}
@@ -0,0 +1,49 @@
+//
+#include <iostream>
+#include <tuple>
+#include "utility.hpp"
+
+struct Sample {
+    int channel;
+    double gain;
+    const char* name;
+};
+
+// Sum of 0..N-1 computed by a fully unrolled compile-time loop
+template <size_t N>
+constexpr size_t unrolled_sum()
+{
+    size_t sum = 0;
+    myUtility::static_for<N>([&](size_t i) { sum += i; });
+    return sum;
+}
+
+int main() {
+    // Test make_index_sequence
+    std::cout << "make_index_sequence<5>::size(): " << myUtility::make_index_sequence<5>::size() << "\n"; // Expected: 5
+    std::cout << "is_same_v<make_index_sequence<3>, index_sequence<0, 1, 2>>: "
+              << myTypeTraits::is_same_v<myUtility::make_index_sequence<3>, myUtility::index_sequence<0, 1, 2>> << "\n"; // Expected: 1 (true)
+    std::cout << "is_same_v<make_integer_sequence_helper<int, 3>::type, integer_sequence<int, 0, 1, 2>>: "
+              << myTypeTraits::is_same_v<myUtility::make_integer_sequence_helper<int, 3>::type,
+                                         myUtility::integer_sequence<int, 0, 1, 2>> << "\n"; // Expected: 1 (true)
+
+    // Test static_for at compile time
+    constexpr size_t sum = unrolled_sum<100>();
+    std::cout << "unrolled_sum<100>(): " << sum << "\n"; // Expected: 4950
+
+    // Test static_for over the fields of an aggregate
+    Sample sample{ 1, 0.5, "left" };
+    auto fields = std::tie(sample.channel, sample.gain, sample.name);
+    std::cout << "fields:";
+    myUtility::static_for<std::tuple_size_v<decltype(fields)>>([&](auto i) {
+        std::cout << " " << std::get<i>(fields);
+    });
+    std::cout << "\n"; // Expected: 1 0.5 left
+
+    // Test unroll with a remainder
+    int values[10] = {};
+    myUtility::unroll<4>(10, [&](size_t i) { values[i] = static_cast<int>(i * i); });
+    std::cout << "values[9]: " << values[9] << "\n"; // Expected: 81
+
+    return 0;
+}
@@ -0,0 +1,40 @@
+#!/bin/sh
+# Times compilation of compile_time_benchmark.cpp for growing N, separately for
+# make_index_sequence (compiler builtin and library fallback) and for static_for.
+# Usage: ./measure_compile_time.sh [compiler]   (default: c++; extra flags via CXXFLAGS)
+#
+# type_traits.hpp uses the __is_function intrinsic, so the compiler must provide it
+# (clang, or GCC 14 and later); older GCC rejects the header even with -fpermissive.
+CXX="${1:-c++}"
+DIR="$(cd "$(dirname "$0")" && pwd)"
+
+# Seconds taken to syntax-check the benchmark with the given extra flags, or "error"
+compile_seconds() {
+    start=$(date +%s.%N)
+    if ! "$CXX" -std=c++20 $CXXFLAGS -fsyntax-only "$@" "$DIR/compile_time_benchmark.cpp" 2>/dev/null; then
+        echo "error"
+        return
+    fi
+    stop=$(date +%s.%N)
+    echo "$start $stop" | awk '{ printf "%.2f", $2 - $1 }'
+}
+
+# Fail early, with the compiler's diagnostics, when the headers do not build at all
+if ! "$CXX" -std=c++20 $CXXFLAGS -fsyntax-only -DSEQUENCE_SIZE=1 -DBENCHMARK_SEQUENCE \
+        "$DIR/compile_time_benchmark.cpp"; then
+    echo "$CXX cannot compile the headers; see the requirement at the top of this script" >&2
+    exit 1
+fi
+
+printf '%-8s %16s %16s %16s\n' "N" "builtin seq (s)" "fallback seq (s)" "static_for (s)"
+for n in 10 100 1000 2500 5000 10000 100000; do
+    builtin=$(compile_seconds -DSEQUENCE_SIZE=$n -DBENCHMARK_SEQUENCE)
+    fallback=$(compile_seconds -DSEQUENCE_SIZE=$n -DBENCHMARK_SEQUENCE -DMYUTILITY_NO_BUILTIN_INTEGER_SEQ)
+    # static_for is only timed up to 10'000 iterations
+    if [ "$n" -le 10000 ]; then
+        unrolled=$(compile_seconds -DSEQUENCE_SIZE=$n -DBENCHMARK_STATIC_FOR)
+    else
+        unrolled="-"
+    fi
+    printf '%-8s %16s %16s %16s\n' "$n" "$builtin" "$fallback" "$unrolled"
+done
@@ -0,0 +1,144 @@
+//
+// Rolled vs unrolled fixed-size kernels: a dot product of N doubles and an N x N matrix
+// times vector product, each as a plain loop, a static_for loop and an unroll<4> loop.
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "utility.hpp"
+
+// Keeps the optimizer from discarding or hoisting a computed value
+template <typename T>
+inline void do_not_optimize(T& value)
+{
+    asm volatile("" : "+m"(value) : : "memory");
+}
+
+// Median nanoseconds per call of op over `repetitions` timed batches of `calls` calls
+template <typename Op>
+double ns_per_call(int repetitions, long calls, Op op)
+{
+    for (long c = 0; c < calls / 10; ++c) {
+        op();
+    }
+    std::vector<double> samples;
+    for (int r = 0; r < repetitions; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        for (long c = 0; c < calls; ++c) {
+            op();
+        }
+        auto stop = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count() / calls);
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+template <size_t N>
+double dot_rolled(const double* a, const double* b)
+{
+    double sum = 0;
+    for (size_t i = 0; i < N; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+template <size_t N>
+double dot_static_for(const double* a, const double* b)
+{
+    double sum = 0;
+    myUtility::static_for<N>([&](size_t i) { sum += a[i] * b[i]; });
+    return sum;
+}
+
+template <size_t N>
+double dot_unroll4(const double* a, const double* b)
+{
+    double sum = 0;
+    myUtility::unroll<4>(N, [&](size_t i) { sum += a[i] * b[i]; });
+    return sum;
+}
+
+template <size_t N>
+void matvec_rolled(const double* m, const double* x, double* y)
+{
+    for (size_t r = 0; r < N; ++r) {
+        double sum = 0;
+        for (size_t c = 0; c < N; ++c) {
+            sum += m[r * N + c] * x[c];
+        }
+        y[r] = sum;
+    }
+}
+
+template <size_t N>
+void matvec_static_for(const double* m, const double* x, double* y)
+{
+    myUtility::static_for<N>([&](size_t r) {
+        double sum = 0;
+        myUtility::static_for<N>([&](size_t c) { sum += m[r * N + c] * x[c]; });
+        y[r] = sum;
+    });
+}
+
+template <size_t N>
+void run_dot(int repetitions, long calls)
+{
+    std::vector<double> a(N, 1.0001);
+    std::vector<double> b(N, 0.9999);
+    double* pa = a.data();
+    double* pb = b.data();
+    auto bench = [&](auto kernel) {
+        return ns_per_call(repetitions, calls, [&] {
+            do_not_optimize(pa);
+            double sum = kernel(pa, pb);
+            do_not_optimize(sum);
+        });
+    };
+    std::cout << std::left << std::setw(14) << "dot" << std::right << std::setw(6) << N
+              << std::setw(12) << std::fixed << std::setprecision(2) << bench(dot_rolled<N>)
+              << std::setw(12) << bench(dot_static_for<N>)
+              << std::setw(12) << bench(dot_unroll4<N>) << "\n";
+}
+
+template <size_t N>
+void run_matvec(int repetitions, long calls)
+{
+    std::vector<double> m(N * N, 1.0001);
+    std::vector<double> x(N, 0.9999);
+    std::vector<double> y(N);
+    double* pm = m.data();
+    auto bench = [&](auto kernel) {
+        return ns_per_call(repetitions, calls, [&] {
+            do_not_optimize(pm);
+            kernel(pm, x.data(), y.data());
+            do_not_optimize(y[0]);
+        });
+    };
+    std::cout << std::left << std::setw(14) << "matvec" << std::right << std::setw(6) << N
+              << std::setw(12) << std::fixed << std::setprecision(2) << bench(matvec_rolled<N>)
+              << std::setw(12) << bench(matvec_static_for<N>)
+              << std::setw(12) << "-" << "\n";
+}
+
+int main() {
+    const int repetitions = 7;
+    const long calls = 2'000'000;
+
+    std::cout << "ns per call, median of " << repetitions << " batches of " << calls << " calls\n";
+    std::cout << std::left << std::setw(14) << "kernel" << std::right << std::setw(6) << "N"
+              << std::setw(12) << "rolled" << std::setw(12) << "static_for" << std::setw(12) << "unroll<4>" << "\n";
+
+    run_dot<4>(repetitions, calls);
+    run_dot<16>(repetitions, calls);
+    run_dot<64>(repetitions, calls);
+    run_dot<256>(repetitions, calls / 4);
+    run_matvec<3>(repetitions, calls);
+    run_matvec<4>(repetitions, calls);
+    run_matvec<8>(repetitions, calls);
+    run_matvec<16>(repetitions, calls / 4);
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include "../type_traits/type_traits.hpp"
+
+namespace myUtility {
+
+// Integer Sequence: a compile-time pack of integers of type T
+template <typename T, T... Is>
+struct integer_sequence
+{
+    using value_type = T;
+    static constexpr size_t size() noexcept
+    {
+        return sizeof...(Is);
+    }
+};
+
+// Helper alias template for sequences of size_t
+template <size_t... Is>
+using index_sequence = integer_sequence<size_t, Is...>;
+
+// Helper trait joining 0..N1-1 and 0..N2-1 into 0..N1+N2-1
+template <typename First, typename Second>
+struct concat_integer_sequence_helper;
+
+template <typename T, T... I1, T... I2>
+struct concat_integer_sequence_helper<integer_sequence<T, I1...>, integer_sequence<T, I2...>>
+{
+    using type = integer_sequence<T, I1..., static_cast<T>(sizeof...(I1) + I2)...>;
+};
+
+// Library fallback for make_integer_sequence: builds both halves and concatenates them,
+// so the instantiation depth is log2(N) and large N stays below recursion limits
+template <typename T, size_t N>
+struct make_integer_sequence_helper
+{
+    using type = typename concat_integer_sequence_helper<
+        typename make_integer_sequence_helper<T, N / 2>::type,
+        typename make_integer_sequence_helper<T, N - N / 2>::type>::type;
+};
+
+template <typename T>
+struct make_integer_sequence_helper<T, 0>
+{
+    using type = integer_sequence<T>;
+};
+
+template <typename T>
+struct make_integer_sequence_helper<T, 1>
+{
+    using type = integer_sequence<T, 0>;
+};
+
+// Make Integer Sequence: integer_sequence<T, 0, 1, ..., N - 1>. Uses the compiler's
+// builtin when it has one (a single instantiation); define
+// MYUTILITY_NO_BUILTIN_INTEGER_SEQ to force the library fallback.
+#if defined(__has_builtin) && !defined(MYUTILITY_NO_BUILTIN_INTEGER_SEQ)
+#if __has_builtin(__make_integer_seq)
+#define MYUTILITY_BUILTIN_INTEGER_SEQ 1
+template <typename T, T N>
+using make_integer_sequence = __make_integer_seq<integer_sequence, T, N>;
+#elif __has_builtin(__integer_pack)
+#define MYUTILITY_BUILTIN_INTEGER_SEQ 1
+template <typename T, T N>
+using make_integer_sequence = integer_sequence<T, __integer_pack(N)...>;
+#endif
+#endif
+
+#if !defined(MYUTILITY_BUILTIN_INTEGER_SEQ)
+template <typename T, T N>
+using make_integer_sequence = typename make_integer_sequence_helper<T, static_cast<size_t>(N)>::type;
+#endif
+
+// Helper alias template for index sequences
+template <size_t N>
+using make_index_sequence = make_integer_sequence<size_t, N>;
+
+// Index sequence for a parameter pack
+template <typename... Ts>
+using index_sequence_for = make_index_sequence<sizeof...(Ts)>;
+
+// Calls f(integral_constant<size_t, I>{}) for every I in Is, in order. The pack is
+// expanded into a braced initializer (evaluated left to right) rather than a comma fold,
+// which GCC compiles in time quadratic in the pack size.
+template <typename F, size_t... Is>
+constexpr void static_for_helper(F& f, index_sequence<Is...>)
+{
+    if constexpr (sizeof...(Is) != 0) {
+        const bool expansion[] = { (static_cast<void>(f(myTypeTraits::integral_constant<size_t, Is>{})), true)... };
+        static_cast<void>(expansion);
+    }
+}
+
+// Static For: fully unrolls a loop of N iterations at compile time. The body receives the
+// index as an integral_constant, so it can be used as a template argument (e.g. std::get<i>)
+// or converted to size_t. Expands the index pack into a braced initializer (see
+// static_for_helper), with neither recursion nor a comma fold.
+template <size_t N, typename F>
+constexpr void static_for(F&& f)
+{
+    static_for_helper(f, make_index_sequence<N>{});
+}
+
+// Unroll: calls f(i) for every i in [0, n) with the loop body replicated Factor times;
+// the remaining n % Factor iterations run in a plain loop
+template <size_t Factor, typename F>
+constexpr void unroll(size_t n, F&& f)
+{
+    static_assert(Factor > 0, "unroll factor must be positive");
+    size_t i = 0;
+    for (; i + Factor <= n; i += Factor) {
+        static_for<Factor>([&](auto offset) { f(i + offset); });
+    }
+    for (; i < n; ++i) {
+        f(i);
+    }
+}
+
+}